@@ -0,0 +1,47 @@
+#ifndef ALU_H
+#define ALU_H
+#include <stdint.h>
+
+/* flag bits of f */
+enum {
+	FLAG_Z = 1 << 7,
+	FLAG_N = 1 << 6,
+	FLAG_H = 1 << 5,
+	FLAG_C = 1 << 4,
+};
+
+/* cb rotates and shifts in opcode order, (cb >> 3) & 7 */
+enum SHIFT {
+	SHIFT_RLC,
+	SHIFT_RRC,
+	SHIFT_RL,
+	SHIFT_RR,
+	SHIFT_SLA,
+	SHIFT_SRA,
+	SHIFT_SWAP,
+	SHIFT_SRL,
+};
+
+/* tables from alutab.c, regenerate with `make alutab` */
+extern const uint8_t alu_add[512];
+extern const uint8_t alu_sub[512];
+extern const uint8_t alu_hadd[512];
+extern const uint8_t alu_hsub[512];
+extern const uint8_t alu_inc[256];
+extern const uint8_t alu_dec[256];
+extern const uint16_t alu_daa[8 << 8];
+extern const uint16_t alu_shift[8][2][256];
+
+static inline uint8_t
+alu_add_flags(uint8_t x, uint8_t y, uint8_t c)
+{
+	return alu_add[x + y + c] | alu_hadd[c << 8 | (x & 0xf) << 4 | (y & 0xf)];
+}
+
+static inline uint8_t
+alu_sub_flags(uint8_t x, uint8_t y, uint8_t c)
+{
+	return alu_sub[(x - y - c) & 0x1ff] | alu_hsub[c << 8 | (x & 0xf) << 4 | (y & 0xf)];
+}
+
+#endif /* ALU_H */
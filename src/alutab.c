@@ -0,0 +1,1012 @@
+/* generated by tools/alugen.c, do not edit */
+#include <stdint.h>
+
+#include "alu.h"
+
+/* z and c of a 9 bit sum */
+const uint8_t alu_add[512] = {
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x90, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+};
+
+/* z, n and c of a 9 bit difference */
+const uint8_t alu_sub[512] = {
+	0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0xd0, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+	0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50,
+};
+
+/* h of carry << 8 | x << 4 | y, low nibbles */
+const uint8_t alu_hadd[512] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+};
+
+/* h of borrow << 8 | x << 4 | y, low nibbles */
+const uint8_t alu_hsub[512] = {
+	0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+};
+
+/* z and h of an incremented result */
+const uint8_t alu_inc[256] = {
+	0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+/* z, n and h of a decremented result */
+const uint8_t alu_dec[256] = {
+	0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x60,
+};
+
+/* n << 10 | h << 9 | c << 8 | a -> f << 8 | a */
+const uint16_t alu_daa[8 << 8] = {
+	0x8000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+	0x0008, 0x0009, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015,
+	0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+	0x0018, 0x0019, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+	0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+	0x0028, 0x0029, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035,
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+	0x0038, 0x0039, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047,
+	0x0048, 0x0049, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+	0x0058, 0x0059, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+	0x0068, 0x0069, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+	0x0078, 0x0079, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085,
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+	0x0088, 0x0089, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095,
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+	0x0098, 0x0099, 0x9000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005,
+	0x9000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005, 0x1006, 0x1007,
+	0x1008, 0x1009, 0x1010, 0x1011, 0x1012, 0x1013, 0x1014, 0x1015,
+	0x1010, 0x1011, 0x1012, 0x1013, 0x1014, 0x1015, 0x1016, 0x1017,
+	0x1018, 0x1019, 0x1020, 0x1021, 0x1022, 0x1023, 0x1024, 0x1025,
+	0x1020, 0x1021, 0x1022, 0x1023, 0x1024, 0x1025, 0x1026, 0x1027,
+	0x1028, 0x1029, 0x1030, 0x1031, 0x1032, 0x1033, 0x1034, 0x1035,
+	0x1030, 0x1031, 0x1032, 0x1033, 0x1034, 0x1035, 0x1036, 0x1037,
+	0x1038, 0x1039, 0x1040, 0x1041, 0x1042, 0x1043, 0x1044, 0x1045,
+	0x1040, 0x1041, 0x1042, 0x1043, 0x1044, 0x1045, 0x1046, 0x1047,
+	0x1048, 0x1049, 0x1050, 0x1051, 0x1052, 0x1053, 0x1054, 0x1055,
+	0x1050, 0x1051, 0x1052, 0x1053, 0x1054, 0x1055, 0x1056, 0x1057,
+	0x1058, 0x1059, 0x1060, 0x1061, 0x1062, 0x1063, 0x1064, 0x1065,
+	0x1060, 0x1061, 0x1062, 0x1063, 0x1064, 0x1065, 0x1066, 0x1067,
+	0x1068, 0x1069, 0x1070, 0x1071, 0x1072, 0x1073, 0x1074, 0x1075,
+	0x1070, 0x1071, 0x1072, 0x1073, 0x1074, 0x1075, 0x1076, 0x1077,
+	0x1078, 0x1079, 0x1080, 0x1081, 0x1082, 0x1083, 0x1084, 0x1085,
+	0x1080, 0x1081, 0x1082, 0x1083, 0x1084, 0x1085, 0x1086, 0x1087,
+	0x1088, 0x1089, 0x1090, 0x1091, 0x1092, 0x1093, 0x1094, 0x1095,
+	0x1090, 0x1091, 0x1092, 0x1093, 0x1094, 0x1095, 0x1096, 0x1097,
+	0x1098, 0x1099, 0x10a0, 0x10a1, 0x10a2, 0x10a3, 0x10a4, 0x10a5,
+	0x10a0, 0x10a1, 0x10a2, 0x10a3, 0x10a4, 0x10a5, 0x10a6, 0x10a7,
+	0x10a8, 0x10a9, 0x10b0, 0x10b1, 0x10b2, 0x10b3, 0x10b4, 0x10b5,
+	0x10b0, 0x10b1, 0x10b2, 0x10b3, 0x10b4, 0x10b5, 0x10b6, 0x10b7,
+	0x10b8, 0x10b9, 0x10c0, 0x10c1, 0x10c2, 0x10c3, 0x10c4, 0x10c5,
+	0x10c0, 0x10c1, 0x10c2, 0x10c3, 0x10c4, 0x10c5, 0x10c6, 0x10c7,
+	0x10c8, 0x10c9, 0x10d0, 0x10d1, 0x10d2, 0x10d3, 0x10d4, 0x10d5,
+	0x10d0, 0x10d1, 0x10d2, 0x10d3, 0x10d4, 0x10d5, 0x10d6, 0x10d7,
+	0x10d8, 0x10d9, 0x10e0, 0x10e1, 0x10e2, 0x10e3, 0x10e4, 0x10e5,
+	0x10e0, 0x10e1, 0x10e2, 0x10e3, 0x10e4, 0x10e5, 0x10e6, 0x10e7,
+	0x10e8, 0x10e9, 0x10f0, 0x10f1, 0x10f2, 0x10f3, 0x10f4, 0x10f5,
+	0x10f0, 0x10f1, 0x10f2, 0x10f3, 0x10f4, 0x10f5, 0x10f6, 0x10f7,
+	0x10f8, 0x10f9, 0x9000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005,
+	0x9000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005, 0x1006, 0x1007,
+	0x1008, 0x1009, 0x1010, 0x1011, 0x1012, 0x1013, 0x1014, 0x1015,
+	0x1010, 0x1011, 0x1012, 0x1013, 0x1014, 0x1015, 0x1016, 0x1017,
+	0x1018, 0x1019, 0x1020, 0x1021, 0x1022, 0x1023, 0x1024, 0x1025,
+	0x1020, 0x1021, 0x1022, 0x1023, 0x1024, 0x1025, 0x1026, 0x1027,
+	0x1028, 0x1029, 0x1030, 0x1031, 0x1032, 0x1033, 0x1034, 0x1035,
+	0x1030, 0x1031, 0x1032, 0x1033, 0x1034, 0x1035, 0x1036, 0x1037,
+	0x1038, 0x1039, 0x1040, 0x1041, 0x1042, 0x1043, 0x1044, 0x1045,
+	0x1040, 0x1041, 0x1042, 0x1043, 0x1044, 0x1045, 0x1046, 0x1047,
+	0x1048, 0x1049, 0x1050, 0x1051, 0x1052, 0x1053, 0x1054, 0x1055,
+	0x1050, 0x1051, 0x1052, 0x1053, 0x1054, 0x1055, 0x1056, 0x1057,
+	0x1058, 0x1059, 0x1060, 0x1061, 0x1062, 0x1063, 0x1064, 0x1065,
+	0x0006, 0x0007, 0x0008, 0x0009, 0x000a, 0x000b, 0x000c, 0x000d,
+	0x000e, 0x000f, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015,
+	0x0016, 0x0017, 0x0018, 0x0019, 0x001a, 0x001b, 0x001c, 0x001d,
+	0x001e, 0x001f, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025,
+	0x0026, 0x0027, 0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d,
+	0x002e, 0x002f, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035,
+	0x0036, 0x0037, 0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d,
+	0x003e, 0x003f, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+	0x0046, 0x0047, 0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d,
+	0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055,
+	0x0056, 0x0057, 0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d,
+	0x005e, 0x005f, 0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065,
+	0x0066, 0x0067, 0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d,
+	0x006e, 0x006f, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+	0x0076, 0x0077, 0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d,
+	0x007e, 0x007f, 0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085,
+	0x0086, 0x0087, 0x0088, 0x0089, 0x008a, 0x008b, 0x008c, 0x008d,
+	0x008e, 0x008f, 0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095,
+	0x0096, 0x0097, 0x0098, 0x0099, 0x009a, 0x009b, 0x009c, 0x009d,
+	0x009e, 0x009f, 0x9000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005,
+	0x1006, 0x1007, 0x1008, 0x1009, 0x100a, 0x100b, 0x100c, 0x100d,
+	0x100e, 0x100f, 0x1010, 0x1011, 0x1012, 0x1013, 0x1014, 0x1015,
+	0x1016, 0x1017, 0x1018, 0x1019, 0x101a, 0x101b, 0x101c, 0x101d,
+	0x101e, 0x101f, 0x1020, 0x1021, 0x1022, 0x1023, 0x1024, 0x1025,
+	0x1026, 0x1027, 0x1028, 0x1029, 0x102a, 0x102b, 0x102c, 0x102d,
+	0x102e, 0x102f, 0x1030, 0x1031, 0x1032, 0x1033, 0x1034, 0x1035,
+	0x1036, 0x1037, 0x1038, 0x1039, 0x103a, 0x103b, 0x103c, 0x103d,
+	0x103e, 0x103f, 0x1040, 0x1041, 0x1042, 0x1043, 0x1044, 0x1045,
+	0x1046, 0x1047, 0x1048, 0x1049, 0x104a, 0x104b, 0x104c, 0x104d,
+	0x104e, 0x104f, 0x1050, 0x1051, 0x1052, 0x1053, 0x1054, 0x1055,
+	0x1056, 0x1057, 0x1058, 0x1059, 0x105a, 0x105b, 0x105c, 0x105d,
+	0x105e, 0x105f, 0x1060, 0x1061, 0x1062, 0x1063, 0x1064, 0x1065,
+	0x1066, 0x1067, 0x1068, 0x1069, 0x106a, 0x106b, 0x106c, 0x106d,
+	0x106e, 0x106f, 0x1070, 0x1071, 0x1072, 0x1073, 0x1074, 0x1075,
+	0x1076, 0x1077, 0x1078, 0x1079, 0x107a, 0x107b, 0x107c, 0x107d,
+	0x107e, 0x107f, 0x1080, 0x1081, 0x1082, 0x1083, 0x1084, 0x1085,
+	0x1086, 0x1087, 0x1088, 0x1089, 0x108a, 0x108b, 0x108c, 0x108d,
+	0x108e, 0x108f, 0x1090, 0x1091, 0x1092, 0x1093, 0x1094, 0x1095,
+	0x1096, 0x1097, 0x1098, 0x1099, 0x109a, 0x109b, 0x109c, 0x109d,
+	0x109e, 0x109f, 0x10a0, 0x10a1, 0x10a2, 0x10a3, 0x10a4, 0x10a5,
+	0x10a6, 0x10a7, 0x10a8, 0x10a9, 0x10aa, 0x10ab, 0x10ac, 0x10ad,
+	0x10ae, 0x10af, 0x10b0, 0x10b1, 0x10b2, 0x10b3, 0x10b4, 0x10b5,
+	0x10b6, 0x10b7, 0x10b8, 0x10b9, 0x10ba, 0x10bb, 0x10bc, 0x10bd,
+	0x10be, 0x10bf, 0x10c0, 0x10c1, 0x10c2, 0x10c3, 0x10c4, 0x10c5,
+	0x10c6, 0x10c7, 0x10c8, 0x10c9, 0x10ca, 0x10cb, 0x10cc, 0x10cd,
+	0x10ce, 0x10cf, 0x10d0, 0x10d1, 0x10d2, 0x10d3, 0x10d4, 0x10d5,
+	0x10d6, 0x10d7, 0x10d8, 0x10d9, 0x10da, 0x10db, 0x10dc, 0x10dd,
+	0x10de, 0x10df, 0x10e0, 0x10e1, 0x10e2, 0x10e3, 0x10e4, 0x10e5,
+	0x10e6, 0x10e7, 0x10e8, 0x10e9, 0x10ea, 0x10eb, 0x10ec, 0x10ed,
+	0x10ee, 0x10ef, 0x10f0, 0x10f1, 0x10f2, 0x10f3, 0x10f4, 0x10f5,
+	0x10f6, 0x10f7, 0x10f8, 0x10f9, 0x10fa, 0x10fb, 0x10fc, 0x10fd,
+	0x10fe, 0x10ff, 0x9000, 0x1001, 0x1002, 0x1003, 0x1004, 0x1005,
+	0x1006, 0x1007, 0x1008, 0x1009, 0x100a, 0x100b, 0x100c, 0x100d,
+	0x100e, 0x100f, 0x1010, 0x1011, 0x1012, 0x1013, 0x1014, 0x1015,
+	0x1016, 0x1017, 0x1018, 0x1019, 0x101a, 0x101b, 0x101c, 0x101d,
+	0x101e, 0x101f, 0x1020, 0x1021, 0x1022, 0x1023, 0x1024, 0x1025,
+	0x1026, 0x1027, 0x1028, 0x1029, 0x102a, 0x102b, 0x102c, 0x102d,
+	0x102e, 0x102f, 0x1030, 0x1031, 0x1032, 0x1033, 0x1034, 0x1035,
+	0x1036, 0x1037, 0x1038, 0x1039, 0x103a, 0x103b, 0x103c, 0x103d,
+	0x103e, 0x103f, 0x1040, 0x1041, 0x1042, 0x1043, 0x1044, 0x1045,
+	0x1046, 0x1047, 0x1048, 0x1049, 0x104a, 0x104b, 0x104c, 0x104d,
+	0x104e, 0x104f, 0x1050, 0x1051, 0x1052, 0x1053, 0x1054, 0x1055,
+	0x1056, 0x1057, 0x1058, 0x1059, 0x105a, 0x105b, 0x105c, 0x105d,
+	0x105e, 0x105f, 0x1060, 0x1061, 0x1062, 0x1063, 0x1064, 0x1065,
+	0xc000, 0x4001, 0x4002, 0x4003, 0x4004, 0x4005, 0x4006, 0x4007,
+	0x4008, 0x4009, 0x400a, 0x400b, 0x400c, 0x400d, 0x400e, 0x400f,
+	0x4010, 0x4011, 0x4012, 0x4013, 0x4014, 0x4015, 0x4016, 0x4017,
+	0x4018, 0x4019, 0x401a, 0x401b, 0x401c, 0x401d, 0x401e, 0x401f,
+	0x4020, 0x4021, 0x4022, 0x4023, 0x4024, 0x4025, 0x4026, 0x4027,
+	0x4028, 0x4029, 0x402a, 0x402b, 0x402c, 0x402d, 0x402e, 0x402f,
+	0x4030, 0x4031, 0x4032, 0x4033, 0x4034, 0x4035, 0x4036, 0x4037,
+	0x4038, 0x4039, 0x403a, 0x403b, 0x403c, 0x403d, 0x403e, 0x403f,
+	0x4040, 0x4041, 0x4042, 0x4043, 0x4044, 0x4045, 0x4046, 0x4047,
+	0x4048, 0x4049, 0x404a, 0x404b, 0x404c, 0x404d, 0x404e, 0x404f,
+	0x4050, 0x4051, 0x4052, 0x4053, 0x4054, 0x4055, 0x4056, 0x4057,
+	0x4058, 0x4059, 0x405a, 0x405b, 0x405c, 0x405d, 0x405e, 0x405f,
+	0x4060, 0x4061, 0x4062, 0x4063, 0x4064, 0x4065, 0x4066, 0x4067,
+	0x4068, 0x4069, 0x406a, 0x406b, 0x406c, 0x406d, 0x406e, 0x406f,
+	0x4070, 0x4071, 0x4072, 0x4073, 0x4074, 0x4075, 0x4076, 0x4077,
+	0x4078, 0x4079, 0x407a, 0x407b, 0x407c, 0x407d, 0x407e, 0x407f,
+	0x4080, 0x4081, 0x4082, 0x4083, 0x4084, 0x4085, 0x4086, 0x4087,
+	0x4088, 0x4089, 0x408a, 0x408b, 0x408c, 0x408d, 0x408e, 0x408f,
+	0x4090, 0x4091, 0x4092, 0x4093, 0x4094, 0x4095, 0x4096, 0x4097,
+	0x4098, 0x4099, 0x409a, 0x409b, 0x409c, 0x409d, 0x409e, 0x409f,
+	0x40a0, 0x40a1, 0x40a2, 0x40a3, 0x40a4, 0x40a5, 0x40a6, 0x40a7,
+	0x40a8, 0x40a9, 0x40aa, 0x40ab, 0x40ac, 0x40ad, 0x40ae, 0x40af,
+	0x40b0, 0x40b1, 0x40b2, 0x40b3, 0x40b4, 0x40b5, 0x40b6, 0x40b7,
+	0x40b8, 0x40b9, 0x40ba, 0x40bb, 0x40bc, 0x40bd, 0x40be, 0x40bf,
+	0x40c0, 0x40c1, 0x40c2, 0x40c3, 0x40c4, 0x40c5, 0x40c6, 0x40c7,
+	0x40c8, 0x40c9, 0x40ca, 0x40cb, 0x40cc, 0x40cd, 0x40ce, 0x40cf,
+	0x40d0, 0x40d1, 0x40d2, 0x40d3, 0x40d4, 0x40d5, 0x40d6, 0x40d7,
+	0x40d8, 0x40d9, 0x40da, 0x40db, 0x40dc, 0x40dd, 0x40de, 0x40df,
+	0x40e0, 0x40e1, 0x40e2, 0x40e3, 0x40e4, 0x40e5, 0x40e6, 0x40e7,
+	0x40e8, 0x40e9, 0x40ea, 0x40eb, 0x40ec, 0x40ed, 0x40ee, 0x40ef,
+	0x40f0, 0x40f1, 0x40f2, 0x40f3, 0x40f4, 0x40f5, 0x40f6, 0x40f7,
+	0x40f8, 0x40f9, 0x40fa, 0x40fb, 0x40fc, 0x40fd, 0x40fe, 0x40ff,
+	0x50a0, 0x50a1, 0x50a2, 0x50a3, 0x50a4, 0x50a5, 0x50a6, 0x50a7,
+	0x50a8, 0x50a9, 0x50aa, 0x50ab, 0x50ac, 0x50ad, 0x50ae, 0x50af,
+	0x50b0, 0x50b1, 0x50b2, 0x50b3, 0x50b4, 0x50b5, 0x50b6, 0x50b7,
+	0x50b8, 0x50b9, 0x50ba, 0x50bb, 0x50bc, 0x50bd, 0x50be, 0x50bf,
+	0x50c0, 0x50c1, 0x50c2, 0x50c3, 0x50c4, 0x50c5, 0x50c6, 0x50c7,
+	0x50c8, 0x50c9, 0x50ca, 0x50cb, 0x50cc, 0x50cd, 0x50ce, 0x50cf,
+	0x50d0, 0x50d1, 0x50d2, 0x50d3, 0x50d4, 0x50d5, 0x50d6, 0x50d7,
+	0x50d8, 0x50d9, 0x50da, 0x50db, 0x50dc, 0x50dd, 0x50de, 0x50df,
+	0x50e0, 0x50e1, 0x50e2, 0x50e3, 0x50e4, 0x50e5, 0x50e6, 0x50e7,
+	0x50e8, 0x50e9, 0x50ea, 0x50eb, 0x50ec, 0x50ed, 0x50ee, 0x50ef,
+	0x50f0, 0x50f1, 0x50f2, 0x50f3, 0x50f4, 0x50f5, 0x50f6, 0x50f7,
+	0x50f8, 0x50f9, 0x50fa, 0x50fb, 0x50fc, 0x50fd, 0x50fe, 0x50ff,
+	0xd000, 0x5001, 0x5002, 0x5003, 0x5004, 0x5005, 0x5006, 0x5007,
+	0x5008, 0x5009, 0x500a, 0x500b, 0x500c, 0x500d, 0x500e, 0x500f,
+	0x5010, 0x5011, 0x5012, 0x5013, 0x5014, 0x5015, 0x5016, 0x5017,
+	0x5018, 0x5019, 0x501a, 0x501b, 0x501c, 0x501d, 0x501e, 0x501f,
+	0x5020, 0x5021, 0x5022, 0x5023, 0x5024, 0x5025, 0x5026, 0x5027,
+	0x5028, 0x5029, 0x502a, 0x502b, 0x502c, 0x502d, 0x502e, 0x502f,
+	0x5030, 0x5031, 0x5032, 0x5033, 0x5034, 0x5035, 0x5036, 0x5037,
+	0x5038, 0x5039, 0x503a, 0x503b, 0x503c, 0x503d, 0x503e, 0x503f,
+	0x5040, 0x5041, 0x5042, 0x5043, 0x5044, 0x5045, 0x5046, 0x5047,
+	0x5048, 0x5049, 0x504a, 0x504b, 0x504c, 0x504d, 0x504e, 0x504f,
+	0x5050, 0x5051, 0x5052, 0x5053, 0x5054, 0x5055, 0x5056, 0x5057,
+	0x5058, 0x5059, 0x505a, 0x505b, 0x505c, 0x505d, 0x505e, 0x505f,
+	0x5060, 0x5061, 0x5062, 0x5063, 0x5064, 0x5065, 0x5066, 0x5067,
+	0x5068, 0x5069, 0x506a, 0x506b, 0x506c, 0x506d, 0x506e, 0x506f,
+	0x5070, 0x5071, 0x5072, 0x5073, 0x5074, 0x5075, 0x5076, 0x5077,
+	0x5078, 0x5079, 0x507a, 0x507b, 0x507c, 0x507d, 0x507e, 0x507f,
+	0x5080, 0x5081, 0x5082, 0x5083, 0x5084, 0x5085, 0x5086, 0x5087,
+	0x5088, 0x5089, 0x508a, 0x508b, 0x508c, 0x508d, 0x508e, 0x508f,
+	0x5090, 0x5091, 0x5092, 0x5093, 0x5094, 0x5095, 0x5096, 0x5097,
+	0x5098, 0x5099, 0x509a, 0x509b, 0x509c, 0x509d, 0x509e, 0x509f,
+	0x40fa, 0x40fb, 0x40fc, 0x40fd, 0x40fe, 0x40ff, 0xc000, 0x4001,
+	0x4002, 0x4003, 0x4004, 0x4005, 0x4006, 0x4007, 0x4008, 0x4009,
+	0x400a, 0x400b, 0x400c, 0x400d, 0x400e, 0x400f, 0x4010, 0x4011,
+	0x4012, 0x4013, 0x4014, 0x4015, 0x4016, 0x4017, 0x4018, 0x4019,
+	0x401a, 0x401b, 0x401c, 0x401d, 0x401e, 0x401f, 0x4020, 0x4021,
+	0x4022, 0x4023, 0x4024, 0x4025, 0x4026, 0x4027, 0x4028, 0x4029,
+	0x402a, 0x402b, 0x402c, 0x402d, 0x402e, 0x402f, 0x4030, 0x4031,
+	0x4032, 0x4033, 0x4034, 0x4035, 0x4036, 0x4037, 0x4038, 0x4039,
+	0x403a, 0x403b, 0x403c, 0x403d, 0x403e, 0x403f, 0x4040, 0x4041,
+	0x4042, 0x4043, 0x4044, 0x4045, 0x4046, 0x4047, 0x4048, 0x4049,
+	0x404a, 0x404b, 0x404c, 0x404d, 0x404e, 0x404f, 0x4050, 0x4051,
+	0x4052, 0x4053, 0x4054, 0x4055, 0x4056, 0x4057, 0x4058, 0x4059,
+	0x405a, 0x405b, 0x405c, 0x405d, 0x405e, 0x405f, 0x4060, 0x4061,
+	0x4062, 0x4063, 0x4064, 0x4065, 0x4066, 0x4067, 0x4068, 0x4069,
+	0x406a, 0x406b, 0x406c, 0x406d, 0x406e, 0x406f, 0x4070, 0x4071,
+	0x4072, 0x4073, 0x4074, 0x4075, 0x4076, 0x4077, 0x4078, 0x4079,
+	0x407a, 0x407b, 0x407c, 0x407d, 0x407e, 0x407f, 0x4080, 0x4081,
+	0x4082, 0x4083, 0x4084, 0x4085, 0x4086, 0x4087, 0x4088, 0x4089,
+	0x408a, 0x408b, 0x408c, 0x408d, 0x408e, 0x408f, 0x4090, 0x4091,
+	0x4092, 0x4093, 0x4094, 0x4095, 0x4096, 0x4097, 0x4098, 0x4099,
+	0x409a, 0x409b, 0x409c, 0x409d, 0x409e, 0x409f, 0x40a0, 0x40a1,
+	0x40a2, 0x40a3, 0x40a4, 0x40a5, 0x40a6, 0x40a7, 0x40a8, 0x40a9,
+	0x40aa, 0x40ab, 0x40ac, 0x40ad, 0x40ae, 0x40af, 0x40b0, 0x40b1,
+	0x40b2, 0x40b3, 0x40b4, 0x40b5, 0x40b6, 0x40b7, 0x40b8, 0x40b9,
+	0x40ba, 0x40bb, 0x40bc, 0x40bd, 0x40be, 0x40bf, 0x40c0, 0x40c1,
+	0x40c2, 0x40c3, 0x40c4, 0x40c5, 0x40c6, 0x40c7, 0x40c8, 0x40c9,
+	0x40ca, 0x40cb, 0x40cc, 0x40cd, 0x40ce, 0x40cf, 0x40d0, 0x40d1,
+	0x40d2, 0x40d3, 0x40d4, 0x40d5, 0x40d6, 0x40d7, 0x40d8, 0x40d9,
+	0x40da, 0x40db, 0x40dc, 0x40dd, 0x40de, 0x40df, 0x40e0, 0x40e1,
+	0x40e2, 0x40e3, 0x40e4, 0x40e5, 0x40e6, 0x40e7, 0x40e8, 0x40e9,
+	0x40ea, 0x40eb, 0x40ec, 0x40ed, 0x40ee, 0x40ef, 0x40f0, 0x40f1,
+	0x40f2, 0x40f3, 0x40f4, 0x40f5, 0x40f6, 0x40f7, 0x40f8, 0x40f9,
+	0x509a, 0x509b, 0x509c, 0x509d, 0x509e, 0x509f, 0x50a0, 0x50a1,
+	0x50a2, 0x50a3, 0x50a4, 0x50a5, 0x50a6, 0x50a7, 0x50a8, 0x50a9,
+	0x50aa, 0x50ab, 0x50ac, 0x50ad, 0x50ae, 0x50af, 0x50b0, 0x50b1,
+	0x50b2, 0x50b3, 0x50b4, 0x50b5, 0x50b6, 0x50b7, 0x50b8, 0x50b9,
+	0x50ba, 0x50bb, 0x50bc, 0x50bd, 0x50be, 0x50bf, 0x50c0, 0x50c1,
+	0x50c2, 0x50c3, 0x50c4, 0x50c5, 0x50c6, 0x50c7, 0x50c8, 0x50c9,
+	0x50ca, 0x50cb, 0x50cc, 0x50cd, 0x50ce, 0x50cf, 0x50d0, 0x50d1,
+	0x50d2, 0x50d3, 0x50d4, 0x50d5, 0x50d6, 0x50d7, 0x50d8, 0x50d9,
+	0x50da, 0x50db, 0x50dc, 0x50dd, 0x50de, 0x50df, 0x50e0, 0x50e1,
+	0x50e2, 0x50e3, 0x50e4, 0x50e5, 0x50e6, 0x50e7, 0x50e8, 0x50e9,
+	0x50ea, 0x50eb, 0x50ec, 0x50ed, 0x50ee, 0x50ef, 0x50f0, 0x50f1,
+	0x50f2, 0x50f3, 0x50f4, 0x50f5, 0x50f6, 0x50f7, 0x50f8, 0x50f9,
+	0x50fa, 0x50fb, 0x50fc, 0x50fd, 0x50fe, 0x50ff, 0xd000, 0x5001,
+	0x5002, 0x5003, 0x5004, 0x5005, 0x5006, 0x5007, 0x5008, 0x5009,
+	0x500a, 0x500b, 0x500c, 0x500d, 0x500e, 0x500f, 0x5010, 0x5011,
+	0x5012, 0x5013, 0x5014, 0x5015, 0x5016, 0x5017, 0x5018, 0x5019,
+	0x501a, 0x501b, 0x501c, 0x501d, 0x501e, 0x501f, 0x5020, 0x5021,
+	0x5022, 0x5023, 0x5024, 0x5025, 0x5026, 0x5027, 0x5028, 0x5029,
+	0x502a, 0x502b, 0x502c, 0x502d, 0x502e, 0x502f, 0x5030, 0x5031,
+	0x5032, 0x5033, 0x5034, 0x5035, 0x5036, 0x5037, 0x5038, 0x5039,
+	0x503a, 0x503b, 0x503c, 0x503d, 0x503e, 0x503f, 0x5040, 0x5041,
+	0x5042, 0x5043, 0x5044, 0x5045, 0x5046, 0x5047, 0x5048, 0x5049,
+	0x504a, 0x504b, 0x504c, 0x504d, 0x504e, 0x504f, 0x5050, 0x5051,
+	0x5052, 0x5053, 0x5054, 0x5055, 0x5056, 0x5057, 0x5058, 0x5059,
+	0x505a, 0x505b, 0x505c, 0x505d, 0x505e, 0x505f, 0x5060, 0x5061,
+	0x5062, 0x5063, 0x5064, 0x5065, 0x5066, 0x5067, 0x5068, 0x5069,
+	0x506a, 0x506b, 0x506c, 0x506d, 0x506e, 0x506f, 0x5070, 0x5071,
+	0x5072, 0x5073, 0x5074, 0x5075, 0x5076, 0x5077, 0x5078, 0x5079,
+	0x507a, 0x507b, 0x507c, 0x507d, 0x507e, 0x507f, 0x5080, 0x5081,
+	0x5082, 0x5083, 0x5084, 0x5085, 0x5086, 0x5087, 0x5088, 0x5089,
+	0x508a, 0x508b, 0x508c, 0x508d, 0x508e, 0x508f, 0x5090, 0x5091,
+	0x5092, 0x5093, 0x5094, 0x5095, 0x5096, 0x5097, 0x5098, 0x5099,
+};
+
+/* op, carry in, x -> f << 8 | res */
+const uint16_t alu_shift[8][2][256] = {
+	{ /* rlc */
+		{
+			0x8000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000e,
+			0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c, 0x001e,
+			0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e,
+			0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x003a, 0x003c, 0x003e,
+			0x0040, 0x0042, 0x0044, 0x0046, 0x0048, 0x004a, 0x004c, 0x004e,
+			0x0050, 0x0052, 0x0054, 0x0056, 0x0058, 0x005a, 0x005c, 0x005e,
+			0x0060, 0x0062, 0x0064, 0x0066, 0x0068, 0x006a, 0x006c, 0x006e,
+			0x0070, 0x0072, 0x0074, 0x0076, 0x0078, 0x007a, 0x007c, 0x007e,
+			0x0080, 0x0082, 0x0084, 0x0086, 0x0088, 0x008a, 0x008c, 0x008e,
+			0x0090, 0x0092, 0x0094, 0x0096, 0x0098, 0x009a, 0x009c, 0x009e,
+			0x00a0, 0x00a2, 0x00a4, 0x00a6, 0x00a8, 0x00aa, 0x00ac, 0x00ae,
+			0x00b0, 0x00b2, 0x00b4, 0x00b6, 0x00b8, 0x00ba, 0x00bc, 0x00be,
+			0x00c0, 0x00c2, 0x00c4, 0x00c6, 0x00c8, 0x00ca, 0x00cc, 0x00ce,
+			0x00d0, 0x00d2, 0x00d4, 0x00d6, 0x00d8, 0x00da, 0x00dc, 0x00de,
+			0x00e0, 0x00e2, 0x00e4, 0x00e6, 0x00e8, 0x00ea, 0x00ec, 0x00ee,
+			0x00f0, 0x00f2, 0x00f4, 0x00f6, 0x00f8, 0x00fa, 0x00fc, 0x00fe,
+			0x1001, 0x1003, 0x1005, 0x1007, 0x1009, 0x100b, 0x100d, 0x100f,
+			0x1011, 0x1013, 0x1015, 0x1017, 0x1019, 0x101b, 0x101d, 0x101f,
+			0x1021, 0x1023, 0x1025, 0x1027, 0x1029, 0x102b, 0x102d, 0x102f,
+			0x1031, 0x1033, 0x1035, 0x1037, 0x1039, 0x103b, 0x103d, 0x103f,
+			0x1041, 0x1043, 0x1045, 0x1047, 0x1049, 0x104b, 0x104d, 0x104f,
+			0x1051, 0x1053, 0x1055, 0x1057, 0x1059, 0x105b, 0x105d, 0x105f,
+			0x1061, 0x1063, 0x1065, 0x1067, 0x1069, 0x106b, 0x106d, 0x106f,
+			0x1071, 0x1073, 0x1075, 0x1077, 0x1079, 0x107b, 0x107d, 0x107f,
+			0x1081, 0x1083, 0x1085, 0x1087, 0x1089, 0x108b, 0x108d, 0x108f,
+			0x1091, 0x1093, 0x1095, 0x1097, 0x1099, 0x109b, 0x109d, 0x109f,
+			0x10a1, 0x10a3, 0x10a5, 0x10a7, 0x10a9, 0x10ab, 0x10ad, 0x10af,
+			0x10b1, 0x10b3, 0x10b5, 0x10b7, 0x10b9, 0x10bb, 0x10bd, 0x10bf,
+			0x10c1, 0x10c3, 0x10c5, 0x10c7, 0x10c9, 0x10cb, 0x10cd, 0x10cf,
+			0x10d1, 0x10d3, 0x10d5, 0x10d7, 0x10d9, 0x10db, 0x10dd, 0x10df,
+			0x10e1, 0x10e3, 0x10e5, 0x10e7, 0x10e9, 0x10eb, 0x10ed, 0x10ef,
+			0x10f1, 0x10f3, 0x10f5, 0x10f7, 0x10f9, 0x10fb, 0x10fd, 0x10ff,
+		},
+		{
+			0x8000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000e,
+			0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c, 0x001e,
+			0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e,
+			0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x003a, 0x003c, 0x003e,
+			0x0040, 0x0042, 0x0044, 0x0046, 0x0048, 0x004a, 0x004c, 0x004e,
+			0x0050, 0x0052, 0x0054, 0x0056, 0x0058, 0x005a, 0x005c, 0x005e,
+			0x0060, 0x0062, 0x0064, 0x0066, 0x0068, 0x006a, 0x006c, 0x006e,
+			0x0070, 0x0072, 0x0074, 0x0076, 0x0078, 0x007a, 0x007c, 0x007e,
+			0x0080, 0x0082, 0x0084, 0x0086, 0x0088, 0x008a, 0x008c, 0x008e,
+			0x0090, 0x0092, 0x0094, 0x0096, 0x0098, 0x009a, 0x009c, 0x009e,
+			0x00a0, 0x00a2, 0x00a4, 0x00a6, 0x00a8, 0x00aa, 0x00ac, 0x00ae,
+			0x00b0, 0x00b2, 0x00b4, 0x00b6, 0x00b8, 0x00ba, 0x00bc, 0x00be,
+			0x00c0, 0x00c2, 0x00c4, 0x00c6, 0x00c8, 0x00ca, 0x00cc, 0x00ce,
+			0x00d0, 0x00d2, 0x00d4, 0x00d6, 0x00d8, 0x00da, 0x00dc, 0x00de,
+			0x00e0, 0x00e2, 0x00e4, 0x00e6, 0x00e8, 0x00ea, 0x00ec, 0x00ee,
+			0x00f0, 0x00f2, 0x00f4, 0x00f6, 0x00f8, 0x00fa, 0x00fc, 0x00fe,
+			0x1001, 0x1003, 0x1005, 0x1007, 0x1009, 0x100b, 0x100d, 0x100f,
+			0x1011, 0x1013, 0x1015, 0x1017, 0x1019, 0x101b, 0x101d, 0x101f,
+			0x1021, 0x1023, 0x1025, 0x1027, 0x1029, 0x102b, 0x102d, 0x102f,
+			0x1031, 0x1033, 0x1035, 0x1037, 0x1039, 0x103b, 0x103d, 0x103f,
+			0x1041, 0x1043, 0x1045, 0x1047, 0x1049, 0x104b, 0x104d, 0x104f,
+			0x1051, 0x1053, 0x1055, 0x1057, 0x1059, 0x105b, 0x105d, 0x105f,
+			0x1061, 0x1063, 0x1065, 0x1067, 0x1069, 0x106b, 0x106d, 0x106f,
+			0x1071, 0x1073, 0x1075, 0x1077, 0x1079, 0x107b, 0x107d, 0x107f,
+			0x1081, 0x1083, 0x1085, 0x1087, 0x1089, 0x108b, 0x108d, 0x108f,
+			0x1091, 0x1093, 0x1095, 0x1097, 0x1099, 0x109b, 0x109d, 0x109f,
+			0x10a1, 0x10a3, 0x10a5, 0x10a7, 0x10a9, 0x10ab, 0x10ad, 0x10af,
+			0x10b1, 0x10b3, 0x10b5, 0x10b7, 0x10b9, 0x10bb, 0x10bd, 0x10bf,
+			0x10c1, 0x10c3, 0x10c5, 0x10c7, 0x10c9, 0x10cb, 0x10cd, 0x10cf,
+			0x10d1, 0x10d3, 0x10d5, 0x10d7, 0x10d9, 0x10db, 0x10dd, 0x10df,
+			0x10e1, 0x10e3, 0x10e5, 0x10e7, 0x10e9, 0x10eb, 0x10ed, 0x10ef,
+			0x10f1, 0x10f3, 0x10f5, 0x10f7, 0x10f9, 0x10fb, 0x10fd, 0x10ff,
+		},
+	},
+	{ /* rrc */
+		{
+			0x8000, 0x1080, 0x0001, 0x1081, 0x0002, 0x1082, 0x0003, 0x1083,
+			0x0004, 0x1084, 0x0005, 0x1085, 0x0006, 0x1086, 0x0007, 0x1087,
+			0x0008, 0x1088, 0x0009, 0x1089, 0x000a, 0x108a, 0x000b, 0x108b,
+			0x000c, 0x108c, 0x000d, 0x108d, 0x000e, 0x108e, 0x000f, 0x108f,
+			0x0010, 0x1090, 0x0011, 0x1091, 0x0012, 0x1092, 0x0013, 0x1093,
+			0x0014, 0x1094, 0x0015, 0x1095, 0x0016, 0x1096, 0x0017, 0x1097,
+			0x0018, 0x1098, 0x0019, 0x1099, 0x001a, 0x109a, 0x001b, 0x109b,
+			0x001c, 0x109c, 0x001d, 0x109d, 0x001e, 0x109e, 0x001f, 0x109f,
+			0x0020, 0x10a0, 0x0021, 0x10a1, 0x0022, 0x10a2, 0x0023, 0x10a3,
+			0x0024, 0x10a4, 0x0025, 0x10a5, 0x0026, 0x10a6, 0x0027, 0x10a7,
+			0x0028, 0x10a8, 0x0029, 0x10a9, 0x002a, 0x10aa, 0x002b, 0x10ab,
+			0x002c, 0x10ac, 0x002d, 0x10ad, 0x002e, 0x10ae, 0x002f, 0x10af,
+			0x0030, 0x10b0, 0x0031, 0x10b1, 0x0032, 0x10b2, 0x0033, 0x10b3,
+			0x0034, 0x10b4, 0x0035, 0x10b5, 0x0036, 0x10b6, 0x0037, 0x10b7,
+			0x0038, 0x10b8, 0x0039, 0x10b9, 0x003a, 0x10ba, 0x003b, 0x10bb,
+			0x003c, 0x10bc, 0x003d, 0x10bd, 0x003e, 0x10be, 0x003f, 0x10bf,
+			0x0040, 0x10c0, 0x0041, 0x10c1, 0x0042, 0x10c2, 0x0043, 0x10c3,
+			0x0044, 0x10c4, 0x0045, 0x10c5, 0x0046, 0x10c6, 0x0047, 0x10c7,
+			0x0048, 0x10c8, 0x0049, 0x10c9, 0x004a, 0x10ca, 0x004b, 0x10cb,
+			0x004c, 0x10cc, 0x004d, 0x10cd, 0x004e, 0x10ce, 0x004f, 0x10cf,
+			0x0050, 0x10d0, 0x0051, 0x10d1, 0x0052, 0x10d2, 0x0053, 0x10d3,
+			0x0054, 0x10d4, 0x0055, 0x10d5, 0x0056, 0x10d6, 0x0057, 0x10d7,
+			0x0058, 0x10d8, 0x0059, 0x10d9, 0x005a, 0x10da, 0x005b, 0x10db,
+			0x005c, 0x10dc, 0x005d, 0x10dd, 0x005e, 0x10de, 0x005f, 0x10df,
+			0x0060, 0x10e0, 0x0061, 0x10e1, 0x0062, 0x10e2, 0x0063, 0x10e3,
+			0x0064, 0x10e4, 0x0065, 0x10e5, 0x0066, 0x10e6, 0x0067, 0x10e7,
+			0x0068, 0x10e8, 0x0069, 0x10e9, 0x006a, 0x10ea, 0x006b, 0x10eb,
+			0x006c, 0x10ec, 0x006d, 0x10ed, 0x006e, 0x10ee, 0x006f, 0x10ef,
+			0x0070, 0x10f0, 0x0071, 0x10f1, 0x0072, 0x10f2, 0x0073, 0x10f3,
+			0x0074, 0x10f4, 0x0075, 0x10f5, 0x0076, 0x10f6, 0x0077, 0x10f7,
+			0x0078, 0x10f8, 0x0079, 0x10f9, 0x007a, 0x10fa, 0x007b, 0x10fb,
+			0x007c, 0x10fc, 0x007d, 0x10fd, 0x007e, 0x10fe, 0x007f, 0x10ff,
+		},
+		{
+			0x8000, 0x1080, 0x0001, 0x1081, 0x0002, 0x1082, 0x0003, 0x1083,
+			0x0004, 0x1084, 0x0005, 0x1085, 0x0006, 0x1086, 0x0007, 0x1087,
+			0x0008, 0x1088, 0x0009, 0x1089, 0x000a, 0x108a, 0x000b, 0x108b,
+			0x000c, 0x108c, 0x000d, 0x108d, 0x000e, 0x108e, 0x000f, 0x108f,
+			0x0010, 0x1090, 0x0011, 0x1091, 0x0012, 0x1092, 0x0013, 0x1093,
+			0x0014, 0x1094, 0x0015, 0x1095, 0x0016, 0x1096, 0x0017, 0x1097,
+			0x0018, 0x1098, 0x0019, 0x1099, 0x001a, 0x109a, 0x001b, 0x109b,
+			0x001c, 0x109c, 0x001d, 0x109d, 0x001e, 0x109e, 0x001f, 0x109f,
+			0x0020, 0x10a0, 0x0021, 0x10a1, 0x0022, 0x10a2, 0x0023, 0x10a3,
+			0x0024, 0x10a4, 0x0025, 0x10a5, 0x0026, 0x10a6, 0x0027, 0x10a7,
+			0x0028, 0x10a8, 0x0029, 0x10a9, 0x002a, 0x10aa, 0x002b, 0x10ab,
+			0x002c, 0x10ac, 0x002d, 0x10ad, 0x002e, 0x10ae, 0x002f, 0x10af,
+			0x0030, 0x10b0, 0x0031, 0x10b1, 0x0032, 0x10b2, 0x0033, 0x10b3,
+			0x0034, 0x10b4, 0x0035, 0x10b5, 0x0036, 0x10b6, 0x0037, 0x10b7,
+			0x0038, 0x10b8, 0x0039, 0x10b9, 0x003a, 0x10ba, 0x003b, 0x10bb,
+			0x003c, 0x10bc, 0x003d, 0x10bd, 0x003e, 0x10be, 0x003f, 0x10bf,
+			0x0040, 0x10c0, 0x0041, 0x10c1, 0x0042, 0x10c2, 0x0043, 0x10c3,
+			0x0044, 0x10c4, 0x0045, 0x10c5, 0x0046, 0x10c6, 0x0047, 0x10c7,
+			0x0048, 0x10c8, 0x0049, 0x10c9, 0x004a, 0x10ca, 0x004b, 0x10cb,
+			0x004c, 0x10cc, 0x004d, 0x10cd, 0x004e, 0x10ce, 0x004f, 0x10cf,
+			0x0050, 0x10d0, 0x0051, 0x10d1, 0x0052, 0x10d2, 0x0053, 0x10d3,
+			0x0054, 0x10d4, 0x0055, 0x10d5, 0x0056, 0x10d6, 0x0057, 0x10d7,
+			0x0058, 0x10d8, 0x0059, 0x10d9, 0x005a, 0x10da, 0x005b, 0x10db,
+			0x005c, 0x10dc, 0x005d, 0x10dd, 0x005e, 0x10de, 0x005f, 0x10df,
+			0x0060, 0x10e0, 0x0061, 0x10e1, 0x0062, 0x10e2, 0x0063, 0x10e3,
+			0x0064, 0x10e4, 0x0065, 0x10e5, 0x0066, 0x10e6, 0x0067, 0x10e7,
+			0x0068, 0x10e8, 0x0069, 0x10e9, 0x006a, 0x10ea, 0x006b, 0x10eb,
+			0x006c, 0x10ec, 0x006d, 0x10ed, 0x006e, 0x10ee, 0x006f, 0x10ef,
+			0x0070, 0x10f0, 0x0071, 0x10f1, 0x0072, 0x10f2, 0x0073, 0x10f3,
+			0x0074, 0x10f4, 0x0075, 0x10f5, 0x0076, 0x10f6, 0x0077, 0x10f7,
+			0x0078, 0x10f8, 0x0079, 0x10f9, 0x007a, 0x10fa, 0x007b, 0x10fb,
+			0x007c, 0x10fc, 0x007d, 0x10fd, 0x007e, 0x10fe, 0x007f, 0x10ff,
+		},
+	},
+	{ /* rl */
+		{
+			0x8000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000e,
+			0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c, 0x001e,
+			0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e,
+			0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x003a, 0x003c, 0x003e,
+			0x0040, 0x0042, 0x0044, 0x0046, 0x0048, 0x004a, 0x004c, 0x004e,
+			0x0050, 0x0052, 0x0054, 0x0056, 0x0058, 0x005a, 0x005c, 0x005e,
+			0x0060, 0x0062, 0x0064, 0x0066, 0x0068, 0x006a, 0x006c, 0x006e,
+			0x0070, 0x0072, 0x0074, 0x0076, 0x0078, 0x007a, 0x007c, 0x007e,
+			0x0080, 0x0082, 0x0084, 0x0086, 0x0088, 0x008a, 0x008c, 0x008e,
+			0x0090, 0x0092, 0x0094, 0x0096, 0x0098, 0x009a, 0x009c, 0x009e,
+			0x00a0, 0x00a2, 0x00a4, 0x00a6, 0x00a8, 0x00aa, 0x00ac, 0x00ae,
+			0x00b0, 0x00b2, 0x00b4, 0x00b6, 0x00b8, 0x00ba, 0x00bc, 0x00be,
+			0x00c0, 0x00c2, 0x00c4, 0x00c6, 0x00c8, 0x00ca, 0x00cc, 0x00ce,
+			0x00d0, 0x00d2, 0x00d4, 0x00d6, 0x00d8, 0x00da, 0x00dc, 0x00de,
+			0x00e0, 0x00e2, 0x00e4, 0x00e6, 0x00e8, 0x00ea, 0x00ec, 0x00ee,
+			0x00f0, 0x00f2, 0x00f4, 0x00f6, 0x00f8, 0x00fa, 0x00fc, 0x00fe,
+			0x9000, 0x1002, 0x1004, 0x1006, 0x1008, 0x100a, 0x100c, 0x100e,
+			0x1010, 0x1012, 0x1014, 0x1016, 0x1018, 0x101a, 0x101c, 0x101e,
+			0x1020, 0x1022, 0x1024, 0x1026, 0x1028, 0x102a, 0x102c, 0x102e,
+			0x1030, 0x1032, 0x1034, 0x1036, 0x1038, 0x103a, 0x103c, 0x103e,
+			0x1040, 0x1042, 0x1044, 0x1046, 0x1048, 0x104a, 0x104c, 0x104e,
+			0x1050, 0x1052, 0x1054, 0x1056, 0x1058, 0x105a, 0x105c, 0x105e,
+			0x1060, 0x1062, 0x1064, 0x1066, 0x1068, 0x106a, 0x106c, 0x106e,
+			0x1070, 0x1072, 0x1074, 0x1076, 0x1078, 0x107a, 0x107c, 0x107e,
+			0x1080, 0x1082, 0x1084, 0x1086, 0x1088, 0x108a, 0x108c, 0x108e,
+			0x1090, 0x1092, 0x1094, 0x1096, 0x1098, 0x109a, 0x109c, 0x109e,
+			0x10a0, 0x10a2, 0x10a4, 0x10a6, 0x10a8, 0x10aa, 0x10ac, 0x10ae,
+			0x10b0, 0x10b2, 0x10b4, 0x10b6, 0x10b8, 0x10ba, 0x10bc, 0x10be,
+			0x10c0, 0x10c2, 0x10c4, 0x10c6, 0x10c8, 0x10ca, 0x10cc, 0x10ce,
+			0x10d0, 0x10d2, 0x10d4, 0x10d6, 0x10d8, 0x10da, 0x10dc, 0x10de,
+			0x10e0, 0x10e2, 0x10e4, 0x10e6, 0x10e8, 0x10ea, 0x10ec, 0x10ee,
+			0x10f0, 0x10f2, 0x10f4, 0x10f6, 0x10f8, 0x10fa, 0x10fc, 0x10fe,
+		},
+		{
+			0x0001, 0x0003, 0x0005, 0x0007, 0x0009, 0x000b, 0x000d, 0x000f,
+			0x0011, 0x0013, 0x0015, 0x0017, 0x0019, 0x001b, 0x001d, 0x001f,
+			0x0021, 0x0023, 0x0025, 0x0027, 0x0029, 0x002b, 0x002d, 0x002f,
+			0x0031, 0x0033, 0x0035, 0x0037, 0x0039, 0x003b, 0x003d, 0x003f,
+			0x0041, 0x0043, 0x0045, 0x0047, 0x0049, 0x004b, 0x004d, 0x004f,
+			0x0051, 0x0053, 0x0055, 0x0057, 0x0059, 0x005b, 0x005d, 0x005f,
+			0x0061, 0x0063, 0x0065, 0x0067, 0x0069, 0x006b, 0x006d, 0x006f,
+			0x0071, 0x0073, 0x0075, 0x0077, 0x0079, 0x007b, 0x007d, 0x007f,
+			0x0081, 0x0083, 0x0085, 0x0087, 0x0089, 0x008b, 0x008d, 0x008f,
+			0x0091, 0x0093, 0x0095, 0x0097, 0x0099, 0x009b, 0x009d, 0x009f,
+			0x00a1, 0x00a3, 0x00a5, 0x00a7, 0x00a9, 0x00ab, 0x00ad, 0x00af,
+			0x00b1, 0x00b3, 0x00b5, 0x00b7, 0x00b9, 0x00bb, 0x00bd, 0x00bf,
+			0x00c1, 0x00c3, 0x00c5, 0x00c7, 0x00c9, 0x00cb, 0x00cd, 0x00cf,
+			0x00d1, 0x00d3, 0x00d5, 0x00d7, 0x00d9, 0x00db, 0x00dd, 0x00df,
+			0x00e1, 0x00e3, 0x00e5, 0x00e7, 0x00e9, 0x00eb, 0x00ed, 0x00ef,
+			0x00f1, 0x00f3, 0x00f5, 0x00f7, 0x00f9, 0x00fb, 0x00fd, 0x00ff,
+			0x1001, 0x1003, 0x1005, 0x1007, 0x1009, 0x100b, 0x100d, 0x100f,
+			0x1011, 0x1013, 0x1015, 0x1017, 0x1019, 0x101b, 0x101d, 0x101f,
+			0x1021, 0x1023, 0x1025, 0x1027, 0x1029, 0x102b, 0x102d, 0x102f,
+			0x1031, 0x1033, 0x1035, 0x1037, 0x1039, 0x103b, 0x103d, 0x103f,
+			0x1041, 0x1043, 0x1045, 0x1047, 0x1049, 0x104b, 0x104d, 0x104f,
+			0x1051, 0x1053, 0x1055, 0x1057, 0x1059, 0x105b, 0x105d, 0x105f,
+			0x1061, 0x1063, 0x1065, 0x1067, 0x1069, 0x106b, 0x106d, 0x106f,
+			0x1071, 0x1073, 0x1075, 0x1077, 0x1079, 0x107b, 0x107d, 0x107f,
+			0x1081, 0x1083, 0x1085, 0x1087, 0x1089, 0x108b, 0x108d, 0x108f,
+			0x1091, 0x1093, 0x1095, 0x1097, 0x1099, 0x109b, 0x109d, 0x109f,
+			0x10a1, 0x10a3, 0x10a5, 0x10a7, 0x10a9, 0x10ab, 0x10ad, 0x10af,
+			0x10b1, 0x10b3, 0x10b5, 0x10b7, 0x10b9, 0x10bb, 0x10bd, 0x10bf,
+			0x10c1, 0x10c3, 0x10c5, 0x10c7, 0x10c9, 0x10cb, 0x10cd, 0x10cf,
+			0x10d1, 0x10d3, 0x10d5, 0x10d7, 0x10d9, 0x10db, 0x10dd, 0x10df,
+			0x10e1, 0x10e3, 0x10e5, 0x10e7, 0x10e9, 0x10eb, 0x10ed, 0x10ef,
+			0x10f1, 0x10f3, 0x10f5, 0x10f7, 0x10f9, 0x10fb, 0x10fd, 0x10ff,
+		},
+	},
+	{ /* rr */
+		{
+			0x8000, 0x9000, 0x0001, 0x1001, 0x0002, 0x1002, 0x0003, 0x1003,
+			0x0004, 0x1004, 0x0005, 0x1005, 0x0006, 0x1006, 0x0007, 0x1007,
+			0x0008, 0x1008, 0x0009, 0x1009, 0x000a, 0x100a, 0x000b, 0x100b,
+			0x000c, 0x100c, 0x000d, 0x100d, 0x000e, 0x100e, 0x000f, 0x100f,
+			0x0010, 0x1010, 0x0011, 0x1011, 0x0012, 0x1012, 0x0013, 0x1013,
+			0x0014, 0x1014, 0x0015, 0x1015, 0x0016, 0x1016, 0x0017, 0x1017,
+			0x0018, 0x1018, 0x0019, 0x1019, 0x001a, 0x101a, 0x001b, 0x101b,
+			0x001c, 0x101c, 0x001d, 0x101d, 0x001e, 0x101e, 0x001f, 0x101f,
+			0x0020, 0x1020, 0x0021, 0x1021, 0x0022, 0x1022, 0x0023, 0x1023,
+			0x0024, 0x1024, 0x0025, 0x1025, 0x0026, 0x1026, 0x0027, 0x1027,
+			0x0028, 0x1028, 0x0029, 0x1029, 0x002a, 0x102a, 0x002b, 0x102b,
+			0x002c, 0x102c, 0x002d, 0x102d, 0x002e, 0x102e, 0x002f, 0x102f,
+			0x0030, 0x1030, 0x0031, 0x1031, 0x0032, 0x1032, 0x0033, 0x1033,
+			0x0034, 0x1034, 0x0035, 0x1035, 0x0036, 0x1036, 0x0037, 0x1037,
+			0x0038, 0x1038, 0x0039, 0x1039, 0x003a, 0x103a, 0x003b, 0x103b,
+			0x003c, 0x103c, 0x003d, 0x103d, 0x003e, 0x103e, 0x003f, 0x103f,
+			0x0040, 0x1040, 0x0041, 0x1041, 0x0042, 0x1042, 0x0043, 0x1043,
+			0x0044, 0x1044, 0x0045, 0x1045, 0x0046, 0x1046, 0x0047, 0x1047,
+			0x0048, 0x1048, 0x0049, 0x1049, 0x004a, 0x104a, 0x004b, 0x104b,
+			0x004c, 0x104c, 0x004d, 0x104d, 0x004e, 0x104e, 0x004f, 0x104f,
+			0x0050, 0x1050, 0x0051, 0x1051, 0x0052, 0x1052, 0x0053, 0x1053,
+			0x0054, 0x1054, 0x0055, 0x1055, 0x0056, 0x1056, 0x0057, 0x1057,
+			0x0058, 0x1058, 0x0059, 0x1059, 0x005a, 0x105a, 0x005b, 0x105b,
+			0x005c, 0x105c, 0x005d, 0x105d, 0x005e, 0x105e, 0x005f, 0x105f,
+			0x0060, 0x1060, 0x0061, 0x1061, 0x0062, 0x1062, 0x0063, 0x1063,
+			0x0064, 0x1064, 0x0065, 0x1065, 0x0066, 0x1066, 0x0067, 0x1067,
+			0x0068, 0x1068, 0x0069, 0x1069, 0x006a, 0x106a, 0x006b, 0x106b,
+			0x006c, 0x106c, 0x006d, 0x106d, 0x006e, 0x106e, 0x006f, 0x106f,
+			0x0070, 0x1070, 0x0071, 0x1071, 0x0072, 0x1072, 0x0073, 0x1073,
+			0x0074, 0x1074, 0x0075, 0x1075, 0x0076, 0x1076, 0x0077, 0x1077,
+			0x0078, 0x1078, 0x0079, 0x1079, 0x007a, 0x107a, 0x007b, 0x107b,
+			0x007c, 0x107c, 0x007d, 0x107d, 0x007e, 0x107e, 0x007f, 0x107f,
+		},
+		{
+			0x0080, 0x1080, 0x0081, 0x1081, 0x0082, 0x1082, 0x0083, 0x1083,
+			0x0084, 0x1084, 0x0085, 0x1085, 0x0086, 0x1086, 0x0087, 0x1087,
+			0x0088, 0x1088, 0x0089, 0x1089, 0x008a, 0x108a, 0x008b, 0x108b,
+			0x008c, 0x108c, 0x008d, 0x108d, 0x008e, 0x108e, 0x008f, 0x108f,
+			0x0090, 0x1090, 0x0091, 0x1091, 0x0092, 0x1092, 0x0093, 0x1093,
+			0x0094, 0x1094, 0x0095, 0x1095, 0x0096, 0x1096, 0x0097, 0x1097,
+			0x0098, 0x1098, 0x0099, 0x1099, 0x009a, 0x109a, 0x009b, 0x109b,
+			0x009c, 0x109c, 0x009d, 0x109d, 0x009e, 0x109e, 0x009f, 0x109f,
+			0x00a0, 0x10a0, 0x00a1, 0x10a1, 0x00a2, 0x10a2, 0x00a3, 0x10a3,
+			0x00a4, 0x10a4, 0x00a5, 0x10a5, 0x00a6, 0x10a6, 0x00a7, 0x10a7,
+			0x00a8, 0x10a8, 0x00a9, 0x10a9, 0x00aa, 0x10aa, 0x00ab, 0x10ab,
+			0x00ac, 0x10ac, 0x00ad, 0x10ad, 0x00ae, 0x10ae, 0x00af, 0x10af,
+			0x00b0, 0x10b0, 0x00b1, 0x10b1, 0x00b2, 0x10b2, 0x00b3, 0x10b3,
+			0x00b4, 0x10b4, 0x00b5, 0x10b5, 0x00b6, 0x10b6, 0x00b7, 0x10b7,
+			0x00b8, 0x10b8, 0x00b9, 0x10b9, 0x00ba, 0x10ba, 0x00bb, 0x10bb,
+			0x00bc, 0x10bc, 0x00bd, 0x10bd, 0x00be, 0x10be, 0x00bf, 0x10bf,
+			0x00c0, 0x10c0, 0x00c1, 0x10c1, 0x00c2, 0x10c2, 0x00c3, 0x10c3,
+			0x00c4, 0x10c4, 0x00c5, 0x10c5, 0x00c6, 0x10c6, 0x00c7, 0x10c7,
+			0x00c8, 0x10c8, 0x00c9, 0x10c9, 0x00ca, 0x10ca, 0x00cb, 0x10cb,
+			0x00cc, 0x10cc, 0x00cd, 0x10cd, 0x00ce, 0x10ce, 0x00cf, 0x10cf,
+			0x00d0, 0x10d0, 0x00d1, 0x10d1, 0x00d2, 0x10d2, 0x00d3, 0x10d3,
+			0x00d4, 0x10d4, 0x00d5, 0x10d5, 0x00d6, 0x10d6, 0x00d7, 0x10d7,
+			0x00d8, 0x10d8, 0x00d9, 0x10d9, 0x00da, 0x10da, 0x00db, 0x10db,
+			0x00dc, 0x10dc, 0x00dd, 0x10dd, 0x00de, 0x10de, 0x00df, 0x10df,
+			0x00e0, 0x10e0, 0x00e1, 0x10e1, 0x00e2, 0x10e2, 0x00e3, 0x10e3,
+			0x00e4, 0x10e4, 0x00e5, 0x10e5, 0x00e6, 0x10e6, 0x00e7, 0x10e7,
+			0x00e8, 0x10e8, 0x00e9, 0x10e9, 0x00ea, 0x10ea, 0x00eb, 0x10eb,
+			0x00ec, 0x10ec, 0x00ed, 0x10ed, 0x00ee, 0x10ee, 0x00ef, 0x10ef,
+			0x00f0, 0x10f0, 0x00f1, 0x10f1, 0x00f2, 0x10f2, 0x00f3, 0x10f3,
+			0x00f4, 0x10f4, 0x00f5, 0x10f5, 0x00f6, 0x10f6, 0x00f7, 0x10f7,
+			0x00f8, 0x10f8, 0x00f9, 0x10f9, 0x00fa, 0x10fa, 0x00fb, 0x10fb,
+			0x00fc, 0x10fc, 0x00fd, 0x10fd, 0x00fe, 0x10fe, 0x00ff, 0x10ff,
+		},
+	},
+	{ /* sla */
+		{
+			0x8000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000e,
+			0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c, 0x001e,
+			0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e,
+			0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x003a, 0x003c, 0x003e,
+			0x0040, 0x0042, 0x0044, 0x0046, 0x0048, 0x004a, 0x004c, 0x004e,
+			0x0050, 0x0052, 0x0054, 0x0056, 0x0058, 0x005a, 0x005c, 0x005e,
+			0x0060, 0x0062, 0x0064, 0x0066, 0x0068, 0x006a, 0x006c, 0x006e,
+			0x0070, 0x0072, 0x0074, 0x0076, 0x0078, 0x007a, 0x007c, 0x007e,
+			0x0080, 0x0082, 0x0084, 0x0086, 0x0088, 0x008a, 0x008c, 0x008e,
+			0x0090, 0x0092, 0x0094, 0x0096, 0x0098, 0x009a, 0x009c, 0x009e,
+			0x00a0, 0x00a2, 0x00a4, 0x00a6, 0x00a8, 0x00aa, 0x00ac, 0x00ae,
+			0x00b0, 0x00b2, 0x00b4, 0x00b6, 0x00b8, 0x00ba, 0x00bc, 0x00be,
+			0x00c0, 0x00c2, 0x00c4, 0x00c6, 0x00c8, 0x00ca, 0x00cc, 0x00ce,
+			0x00d0, 0x00d2, 0x00d4, 0x00d6, 0x00d8, 0x00da, 0x00dc, 0x00de,
+			0x00e0, 0x00e2, 0x00e4, 0x00e6, 0x00e8, 0x00ea, 0x00ec, 0x00ee,
+			0x00f0, 0x00f2, 0x00f4, 0x00f6, 0x00f8, 0x00fa, 0x00fc, 0x00fe,
+			0x9000, 0x1002, 0x1004, 0x1006, 0x1008, 0x100a, 0x100c, 0x100e,
+			0x1010, 0x1012, 0x1014, 0x1016, 0x1018, 0x101a, 0x101c, 0x101e,
+			0x1020, 0x1022, 0x1024, 0x1026, 0x1028, 0x102a, 0x102c, 0x102e,
+			0x1030, 0x1032, 0x1034, 0x1036, 0x1038, 0x103a, 0x103c, 0x103e,
+			0x1040, 0x1042, 0x1044, 0x1046, 0x1048, 0x104a, 0x104c, 0x104e,
+			0x1050, 0x1052, 0x1054, 0x1056, 0x1058, 0x105a, 0x105c, 0x105e,
+			0x1060, 0x1062, 0x1064, 0x1066, 0x1068, 0x106a, 0x106c, 0x106e,
+			0x1070, 0x1072, 0x1074, 0x1076, 0x1078, 0x107a, 0x107c, 0x107e,
+			0x1080, 0x1082, 0x1084, 0x1086, 0x1088, 0x108a, 0x108c, 0x108e,
+			0x1090, 0x1092, 0x1094, 0x1096, 0x1098, 0x109a, 0x109c, 0x109e,
+			0x10a0, 0x10a2, 0x10a4, 0x10a6, 0x10a8, 0x10aa, 0x10ac, 0x10ae,
+			0x10b0, 0x10b2, 0x10b4, 0x10b6, 0x10b8, 0x10ba, 0x10bc, 0x10be,
+			0x10c0, 0x10c2, 0x10c4, 0x10c6, 0x10c8, 0x10ca, 0x10cc, 0x10ce,
+			0x10d0, 0x10d2, 0x10d4, 0x10d6, 0x10d8, 0x10da, 0x10dc, 0x10de,
+			0x10e0, 0x10e2, 0x10e4, 0x10e6, 0x10e8, 0x10ea, 0x10ec, 0x10ee,
+			0x10f0, 0x10f2, 0x10f4, 0x10f6, 0x10f8, 0x10fa, 0x10fc, 0x10fe,
+		},
+		{
+			0x8000, 0x0002, 0x0004, 0x0006, 0x0008, 0x000a, 0x000c, 0x000e,
+			0x0010, 0x0012, 0x0014, 0x0016, 0x0018, 0x001a, 0x001c, 0x001e,
+			0x0020, 0x0022, 0x0024, 0x0026, 0x0028, 0x002a, 0x002c, 0x002e,
+			0x0030, 0x0032, 0x0034, 0x0036, 0x0038, 0x003a, 0x003c, 0x003e,
+			0x0040, 0x0042, 0x0044, 0x0046, 0x0048, 0x004a, 0x004c, 0x004e,
+			0x0050, 0x0052, 0x0054, 0x0056, 0x0058, 0x005a, 0x005c, 0x005e,
+			0x0060, 0x0062, 0x0064, 0x0066, 0x0068, 0x006a, 0x006c, 0x006e,
+			0x0070, 0x0072, 0x0074, 0x0076, 0x0078, 0x007a, 0x007c, 0x007e,
+			0x0080, 0x0082, 0x0084, 0x0086, 0x0088, 0x008a, 0x008c, 0x008e,
+			0x0090, 0x0092, 0x0094, 0x0096, 0x0098, 0x009a, 0x009c, 0x009e,
+			0x00a0, 0x00a2, 0x00a4, 0x00a6, 0x00a8, 0x00aa, 0x00ac, 0x00ae,
+			0x00b0, 0x00b2, 0x00b4, 0x00b6, 0x00b8, 0x00ba, 0x00bc, 0x00be,
+			0x00c0, 0x00c2, 0x00c4, 0x00c6, 0x00c8, 0x00ca, 0x00cc, 0x00ce,
+			0x00d0, 0x00d2, 0x00d4, 0x00d6, 0x00d8, 0x00da, 0x00dc, 0x00de,
+			0x00e0, 0x00e2, 0x00e4, 0x00e6, 0x00e8, 0x00ea, 0x00ec, 0x00ee,
+			0x00f0, 0x00f2, 0x00f4, 0x00f6, 0x00f8, 0x00fa, 0x00fc, 0x00fe,
+			0x9000, 0x1002, 0x1004, 0x1006, 0x1008, 0x100a, 0x100c, 0x100e,
+			0x1010, 0x1012, 0x1014, 0x1016, 0x1018, 0x101a, 0x101c, 0x101e,
+			0x1020, 0x1022, 0x1024, 0x1026, 0x1028, 0x102a, 0x102c, 0x102e,
+			0x1030, 0x1032, 0x1034, 0x1036, 0x1038, 0x103a, 0x103c, 0x103e,
+			0x1040, 0x1042, 0x1044, 0x1046, 0x1048, 0x104a, 0x104c, 0x104e,
+			0x1050, 0x1052, 0x1054, 0x1056, 0x1058, 0x105a, 0x105c, 0x105e,
+			0x1060, 0x1062, 0x1064, 0x1066, 0x1068, 0x106a, 0x106c, 0x106e,
+			0x1070, 0x1072, 0x1074, 0x1076, 0x1078, 0x107a, 0x107c, 0x107e,
+			0x1080, 0x1082, 0x1084, 0x1086, 0x1088, 0x108a, 0x108c, 0x108e,
+			0x1090, 0x1092, 0x1094, 0x1096, 0x1098, 0x109a, 0x109c, 0x109e,
+			0x10a0, 0x10a2, 0x10a4, 0x10a6, 0x10a8, 0x10aa, 0x10ac, 0x10ae,
+			0x10b0, 0x10b2, 0x10b4, 0x10b6, 0x10b8, 0x10ba, 0x10bc, 0x10be,
+			0x10c0, 0x10c2, 0x10c4, 0x10c6, 0x10c8, 0x10ca, 0x10cc, 0x10ce,
+			0x10d0, 0x10d2, 0x10d4, 0x10d6, 0x10d8, 0x10da, 0x10dc, 0x10de,
+			0x10e0, 0x10e2, 0x10e4, 0x10e6, 0x10e8, 0x10ea, 0x10ec, 0x10ee,
+			0x10f0, 0x10f2, 0x10f4, 0x10f6, 0x10f8, 0x10fa, 0x10fc, 0x10fe,
+		},
+	},
+	{ /* sra */
+		{
+			0x8000, 0x9000, 0x0001, 0x1001, 0x0002, 0x1002, 0x0003, 0x1003,
+			0x0004, 0x1004, 0x0005, 0x1005, 0x0006, 0x1006, 0x0007, 0x1007,
+			0x0008, 0x1008, 0x0009, 0x1009, 0x000a, 0x100a, 0x000b, 0x100b,
+			0x000c, 0x100c, 0x000d, 0x100d, 0x000e, 0x100e, 0x000f, 0x100f,
+			0x0010, 0x1010, 0x0011, 0x1011, 0x0012, 0x1012, 0x0013, 0x1013,
+			0x0014, 0x1014, 0x0015, 0x1015, 0x0016, 0x1016, 0x0017, 0x1017,
+			0x0018, 0x1018, 0x0019, 0x1019, 0x001a, 0x101a, 0x001b, 0x101b,
+			0x001c, 0x101c, 0x001d, 0x101d, 0x001e, 0x101e, 0x001f, 0x101f,
+			0x0020, 0x1020, 0x0021, 0x1021, 0x0022, 0x1022, 0x0023, 0x1023,
+			0x0024, 0x1024, 0x0025, 0x1025, 0x0026, 0x1026, 0x0027, 0x1027,
+			0x0028, 0x1028, 0x0029, 0x1029, 0x002a, 0x102a, 0x002b, 0x102b,
+			0x002c, 0x102c, 0x002d, 0x102d, 0x002e, 0x102e, 0x002f, 0x102f,
+			0x0030, 0x1030, 0x0031, 0x1031, 0x0032, 0x1032, 0x0033, 0x1033,
+			0x0034, 0x1034, 0x0035, 0x1035, 0x0036, 0x1036, 0x0037, 0x1037,
+			0x0038, 0x1038, 0x0039, 0x1039, 0x003a, 0x103a, 0x003b, 0x103b,
+			0x003c, 0x103c, 0x003d, 0x103d, 0x003e, 0x103e, 0x003f, 0x103f,
+			0x00c0, 0x10c0, 0x00c1, 0x10c1, 0x00c2, 0x10c2, 0x00c3, 0x10c3,
+			0x00c4, 0x10c4, 0x00c5, 0x10c5, 0x00c6, 0x10c6, 0x00c7, 0x10c7,
+			0x00c8, 0x10c8, 0x00c9, 0x10c9, 0x00ca, 0x10ca, 0x00cb, 0x10cb,
+			0x00cc, 0x10cc, 0x00cd, 0x10cd, 0x00ce, 0x10ce, 0x00cf, 0x10cf,
+			0x00d0, 0x10d0, 0x00d1, 0x10d1, 0x00d2, 0x10d2, 0x00d3, 0x10d3,
+			0x00d4, 0x10d4, 0x00d5, 0x10d5, 0x00d6, 0x10d6, 0x00d7, 0x10d7,
+			0x00d8, 0x10d8, 0x00d9, 0x10d9, 0x00da, 0x10da, 0x00db, 0x10db,
+			0x00dc, 0x10dc, 0x00dd, 0x10dd, 0x00de, 0x10de, 0x00df, 0x10df,
+			0x00e0, 0x10e0, 0x00e1, 0x10e1, 0x00e2, 0x10e2, 0x00e3, 0x10e3,
+			0x00e4, 0x10e4, 0x00e5, 0x10e5, 0x00e6, 0x10e6, 0x00e7, 0x10e7,
+			0x00e8, 0x10e8, 0x00e9, 0x10e9, 0x00ea, 0x10ea, 0x00eb, 0x10eb,
+			0x00ec, 0x10ec, 0x00ed, 0x10ed, 0x00ee, 0x10ee, 0x00ef, 0x10ef,
+			0x00f0, 0x10f0, 0x00f1, 0x10f1, 0x00f2, 0x10f2, 0x00f3, 0x10f3,
+			0x00f4, 0x10f4, 0x00f5, 0x10f5, 0x00f6, 0x10f6, 0x00f7, 0x10f7,
+			0x00f8, 0x10f8, 0x00f9, 0x10f9, 0x00fa, 0x10fa, 0x00fb, 0x10fb,
+			0x00fc, 0x10fc, 0x00fd, 0x10fd, 0x00fe, 0x10fe, 0x00ff, 0x10ff,
+		},
+		{
+			0x8000, 0x9000, 0x0001, 0x1001, 0x0002, 0x1002, 0x0003, 0x1003,
+			0x0004, 0x1004, 0x0005, 0x1005, 0x0006, 0x1006, 0x0007, 0x1007,
+			0x0008, 0x1008, 0x0009, 0x1009, 0x000a, 0x100a, 0x000b, 0x100b,
+			0x000c, 0x100c, 0x000d, 0x100d, 0x000e, 0x100e, 0x000f, 0x100f,
+			0x0010, 0x1010, 0x0011, 0x1011, 0x0012, 0x1012, 0x0013, 0x1013,
+			0x0014, 0x1014, 0x0015, 0x1015, 0x0016, 0x1016, 0x0017, 0x1017,
+			0x0018, 0x1018, 0x0019, 0x1019, 0x001a, 0x101a, 0x001b, 0x101b,
+			0x001c, 0x101c, 0x001d, 0x101d, 0x001e, 0x101e, 0x001f, 0x101f,
+			0x0020, 0x1020, 0x0021, 0x1021, 0x0022, 0x1022, 0x0023, 0x1023,
+			0x0024, 0x1024, 0x0025, 0x1025, 0x0026, 0x1026, 0x0027, 0x1027,
+			0x0028, 0x1028, 0x0029, 0x1029, 0x002a, 0x102a, 0x002b, 0x102b,
+			0x002c, 0x102c, 0x002d, 0x102d, 0x002e, 0x102e, 0x002f, 0x102f,
+			0x0030, 0x1030, 0x0031, 0x1031, 0x0032, 0x1032, 0x0033, 0x1033,
+			0x0034, 0x1034, 0x0035, 0x1035, 0x0036, 0x1036, 0x0037, 0x1037,
+			0x0038, 0x1038, 0x0039, 0x1039, 0x003a, 0x103a, 0x003b, 0x103b,
+			0x003c, 0x103c, 0x003d, 0x103d, 0x003e, 0x103e, 0x003f, 0x103f,
+			0x00c0, 0x10c0, 0x00c1, 0x10c1, 0x00c2, 0x10c2, 0x00c3, 0x10c3,
+			0x00c4, 0x10c4, 0x00c5, 0x10c5, 0x00c6, 0x10c6, 0x00c7, 0x10c7,
+			0x00c8, 0x10c8, 0x00c9, 0x10c9, 0x00ca, 0x10ca, 0x00cb, 0x10cb,
+			0x00cc, 0x10cc, 0x00cd, 0x10cd, 0x00ce, 0x10ce, 0x00cf, 0x10cf,
+			0x00d0, 0x10d0, 0x00d1, 0x10d1, 0x00d2, 0x10d2, 0x00d3, 0x10d3,
+			0x00d4, 0x10d4, 0x00d5, 0x10d5, 0x00d6, 0x10d6, 0x00d7, 0x10d7,
+			0x00d8, 0x10d8, 0x00d9, 0x10d9, 0x00da, 0x10da, 0x00db, 0x10db,
+			0x00dc, 0x10dc, 0x00dd, 0x10dd, 0x00de, 0x10de, 0x00df, 0x10df,
+			0x00e0, 0x10e0, 0x00e1, 0x10e1, 0x00e2, 0x10e2, 0x00e3, 0x10e3,
+			0x00e4, 0x10e4, 0x00e5, 0x10e5, 0x00e6, 0x10e6, 0x00e7, 0x10e7,
+			0x00e8, 0x10e8, 0x00e9, 0x10e9, 0x00ea, 0x10ea, 0x00eb, 0x10eb,
+			0x00ec, 0x10ec, 0x00ed, 0x10ed, 0x00ee, 0x10ee, 0x00ef, 0x10ef,
+			0x00f0, 0x10f0, 0x00f1, 0x10f1, 0x00f2, 0x10f2, 0x00f3, 0x10f3,
+			0x00f4, 0x10f4, 0x00f5, 0x10f5, 0x00f6, 0x10f6, 0x00f7, 0x10f7,
+			0x00f8, 0x10f8, 0x00f9, 0x10f9, 0x00fa, 0x10fa, 0x00fb, 0x10fb,
+			0x00fc, 0x10fc, 0x00fd, 0x10fd, 0x00fe, 0x10fe, 0x00ff, 0x10ff,
+		},
+	},
+	{ /* swap */
+		{
+			0x8000, 0x0010, 0x0020, 0x0030, 0x0040, 0x0050, 0x0060, 0x0070,
+			0x0080, 0x0090, 0x00a0, 0x00b0, 0x00c0, 0x00d0, 0x00e0, 0x00f0,
+			0x0001, 0x0011, 0x0021, 0x0031, 0x0041, 0x0051, 0x0061, 0x0071,
+			0x0081, 0x0091, 0x00a1, 0x00b1, 0x00c1, 0x00d1, 0x00e1, 0x00f1,
+			0x0002, 0x0012, 0x0022, 0x0032, 0x0042, 0x0052, 0x0062, 0x0072,
+			0x0082, 0x0092, 0x00a2, 0x00b2, 0x00c2, 0x00d2, 0x00e2, 0x00f2,
+			0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x0073,
+			0x0083, 0x0093, 0x00a3, 0x00b3, 0x00c3, 0x00d3, 0x00e3, 0x00f3,
+			0x0004, 0x0014, 0x0024, 0x0034, 0x0044, 0x0054, 0x0064, 0x0074,
+			0x0084, 0x0094, 0x00a4, 0x00b4, 0x00c4, 0x00d4, 0x00e4, 0x00f4,
+			0x0005, 0x0015, 0x0025, 0x0035, 0x0045, 0x0055, 0x0065, 0x0075,
+			0x0085, 0x0095, 0x00a5, 0x00b5, 0x00c5, 0x00d5, 0x00e5, 0x00f5,
+			0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x0076,
+			0x0086, 0x0096, 0x00a6, 0x00b6, 0x00c6, 0x00d6, 0x00e6, 0x00f6,
+			0x0007, 0x0017, 0x0027, 0x0037, 0x0047, 0x0057, 0x0067, 0x0077,
+			0x0087, 0x0097, 0x00a7, 0x00b7, 0x00c7, 0x00d7, 0x00e7, 0x00f7,
+			0x0008, 0x0018, 0x0028, 0x0038, 0x0048, 0x0058, 0x0068, 0x0078,
+			0x0088, 0x0098, 0x00a8, 0x00b8, 0x00c8, 0x00d8, 0x00e8, 0x00f8,
+			0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x0079,
+			0x0089, 0x0099, 0x00a9, 0x00b9, 0x00c9, 0x00d9, 0x00e9, 0x00f9,
+			0x000a, 0x001a, 0x002a, 0x003a, 0x004a, 0x005a, 0x006a, 0x007a,
+			0x008a, 0x009a, 0x00aa, 0x00ba, 0x00ca, 0x00da, 0x00ea, 0x00fa,
+			0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x007b,
+			0x008b, 0x009b, 0x00ab, 0x00bb, 0x00cb, 0x00db, 0x00eb, 0x00fb,
+			0x000c, 0x001c, 0x002c, 0x003c, 0x004c, 0x005c, 0x006c, 0x007c,
+			0x008c, 0x009c, 0x00ac, 0x00bc, 0x00cc, 0x00dc, 0x00ec, 0x00fc,
+			0x000d, 0x001d, 0x002d, 0x003d, 0x004d, 0x005d, 0x006d, 0x007d,
+			0x008d, 0x009d, 0x00ad, 0x00bd, 0x00cd, 0x00dd, 0x00ed, 0x00fd,
+			0x000e, 0x001e, 0x002e, 0x003e, 0x004e, 0x005e, 0x006e, 0x007e,
+			0x008e, 0x009e, 0x00ae, 0x00be, 0x00ce, 0x00de, 0x00ee, 0x00fe,
+			0x000f, 0x001f, 0x002f, 0x003f, 0x004f, 0x005f, 0x006f, 0x007f,
+			0x008f, 0x009f, 0x00af, 0x00bf, 0x00cf, 0x00df, 0x00ef, 0x00ff,
+		},
+		{
+			0x8000, 0x0010, 0x0020, 0x0030, 0x0040, 0x0050, 0x0060, 0x0070,
+			0x0080, 0x0090, 0x00a0, 0x00b0, 0x00c0, 0x00d0, 0x00e0, 0x00f0,
+			0x0001, 0x0011, 0x0021, 0x0031, 0x0041, 0x0051, 0x0061, 0x0071,
+			0x0081, 0x0091, 0x00a1, 0x00b1, 0x00c1, 0x00d1, 0x00e1, 0x00f1,
+			0x0002, 0x0012, 0x0022, 0x0032, 0x0042, 0x0052, 0x0062, 0x0072,
+			0x0082, 0x0092, 0x00a2, 0x00b2, 0x00c2, 0x00d2, 0x00e2, 0x00f2,
+			0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x0073,
+			0x0083, 0x0093, 0x00a3, 0x00b3, 0x00c3, 0x00d3, 0x00e3, 0x00f3,
+			0x0004, 0x0014, 0x0024, 0x0034, 0x0044, 0x0054, 0x0064, 0x0074,
+			0x0084, 0x0094, 0x00a4, 0x00b4, 0x00c4, 0x00d4, 0x00e4, 0x00f4,
+			0x0005, 0x0015, 0x0025, 0x0035, 0x0045, 0x0055, 0x0065, 0x0075,
+			0x0085, 0x0095, 0x00a5, 0x00b5, 0x00c5, 0x00d5, 0x00e5, 0x00f5,
+			0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x0076,
+			0x0086, 0x0096, 0x00a6, 0x00b6, 0x00c6, 0x00d6, 0x00e6, 0x00f6,
+			0x0007, 0x0017, 0x0027, 0x0037, 0x0047, 0x0057, 0x0067, 0x0077,
+			0x0087, 0x0097, 0x00a7, 0x00b7, 0x00c7, 0x00d7, 0x00e7, 0x00f7,
+			0x0008, 0x0018, 0x0028, 0x0038, 0x0048, 0x0058, 0x0068, 0x0078,
+			0x0088, 0x0098, 0x00a8, 0x00b8, 0x00c8, 0x00d8, 0x00e8, 0x00f8,
+			0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x0079,
+			0x0089, 0x0099, 0x00a9, 0x00b9, 0x00c9, 0x00d9, 0x00e9, 0x00f9,
+			0x000a, 0x001a, 0x002a, 0x003a, 0x004a, 0x005a, 0x006a, 0x007a,
+			0x008a, 0x009a, 0x00aa, 0x00ba, 0x00ca, 0x00da, 0x00ea, 0x00fa,
+			0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x007b,
+			0x008b, 0x009b, 0x00ab, 0x00bb, 0x00cb, 0x00db, 0x00eb, 0x00fb,
+			0x000c, 0x001c, 0x002c, 0x003c, 0x004c, 0x005c, 0x006c, 0x007c,
+			0x008c, 0x009c, 0x00ac, 0x00bc, 0x00cc, 0x00dc, 0x00ec, 0x00fc,
+			0x000d, 0x001d, 0x002d, 0x003d, 0x004d, 0x005d, 0x006d, 0x007d,
+			0x008d, 0x009d, 0x00ad, 0x00bd, 0x00cd, 0x00dd, 0x00ed, 0x00fd,
+			0x000e, 0x001e, 0x002e, 0x003e, 0x004e, 0x005e, 0x006e, 0x007e,
+			0x008e, 0x009e, 0x00ae, 0x00be, 0x00ce, 0x00de, 0x00ee, 0x00fe,
+			0x000f, 0x001f, 0x002f, 0x003f, 0x004f, 0x005f, 0x006f, 0x007f,
+			0x008f, 0x009f, 0x00af, 0x00bf, 0x00cf, 0x00df, 0x00ef, 0x00ff,
+		},
+	},
+	{ /* srl */
+		{
+			0x8000, 0x9000, 0x0001, 0x1001, 0x0002, 0x1002, 0x0003, 0x1003,
+			0x0004, 0x1004, 0x0005, 0x1005, 0x0006, 0x1006, 0x0007, 0x1007,
+			0x0008, 0x1008, 0x0009, 0x1009, 0x000a, 0x100a, 0x000b, 0x100b,
+			0x000c, 0x100c, 0x000d, 0x100d, 0x000e, 0x100e, 0x000f, 0x100f,
+			0x0010, 0x1010, 0x0011, 0x1011, 0x0012, 0x1012, 0x0013, 0x1013,
+			0x0014, 0x1014, 0x0015, 0x1015, 0x0016, 0x1016, 0x0017, 0x1017,
+			0x0018, 0x1018, 0x0019, 0x1019, 0x001a, 0x101a, 0x001b, 0x101b,
+			0x001c, 0x101c, 0x001d, 0x101d, 0x001e, 0x101e, 0x001f, 0x101f,
+			0x0020, 0x1020, 0x0021, 0x1021, 0x0022, 0x1022, 0x0023, 0x1023,
+			0x0024, 0x1024, 0x0025, 0x1025, 0x0026, 0x1026, 0x0027, 0x1027,
+			0x0028, 0x1028, 0x0029, 0x1029, 0x002a, 0x102a, 0x002b, 0x102b,
+			0x002c, 0x102c, 0x002d, 0x102d, 0x002e, 0x102e, 0x002f, 0x102f,
+			0x0030, 0x1030, 0x0031, 0x1031, 0x0032, 0x1032, 0x0033, 0x1033,
+			0x0034, 0x1034, 0x0035, 0x1035, 0x0036, 0x1036, 0x0037, 0x1037,
+			0x0038, 0x1038, 0x0039, 0x1039, 0x003a, 0x103a, 0x003b, 0x103b,
+			0x003c, 0x103c, 0x003d, 0x103d, 0x003e, 0x103e, 0x003f, 0x103f,
+			0x0040, 0x1040, 0x0041, 0x1041, 0x0042, 0x1042, 0x0043, 0x1043,
+			0x0044, 0x1044, 0x0045, 0x1045, 0x0046, 0x1046, 0x0047, 0x1047,
+			0x0048, 0x1048, 0x0049, 0x1049, 0x004a, 0x104a, 0x004b, 0x104b,
+			0x004c, 0x104c, 0x004d, 0x104d, 0x004e, 0x104e, 0x004f, 0x104f,
+			0x0050, 0x1050, 0x0051, 0x1051, 0x0052, 0x1052, 0x0053, 0x1053,
+			0x0054, 0x1054, 0x0055, 0x1055, 0x0056, 0x1056, 0x0057, 0x1057,
+			0x0058, 0x1058, 0x0059, 0x1059, 0x005a, 0x105a, 0x005b, 0x105b,
+			0x005c, 0x105c, 0x005d, 0x105d, 0x005e, 0x105e, 0x005f, 0x105f,
+			0x0060, 0x1060, 0x0061, 0x1061, 0x0062, 0x1062, 0x0063, 0x1063,
+			0x0064, 0x1064, 0x0065, 0x1065, 0x0066, 0x1066, 0x0067, 0x1067,
+			0x0068, 0x1068, 0x0069, 0x1069, 0x006a, 0x106a, 0x006b, 0x106b,
+			0x006c, 0x106c, 0x006d, 0x106d, 0x006e, 0x106e, 0x006f, 0x106f,
+			0x0070, 0x1070, 0x0071, 0x1071, 0x0072, 0x1072, 0x0073, 0x1073,
+			0x0074, 0x1074, 0x0075, 0x1075, 0x0076, 0x1076, 0x0077, 0x1077,
+			0x0078, 0x1078, 0x0079, 0x1079, 0x007a, 0x107a, 0x007b, 0x107b,
+			0x007c, 0x107c, 0x007d, 0x107d, 0x007e, 0x107e, 0x007f, 0x107f,
+		},
+		{
+			0x8000, 0x9000, 0x0001, 0x1001, 0x0002, 0x1002, 0x0003, 0x1003,
+			0x0004, 0x1004, 0x0005, 0x1005, 0x0006, 0x1006, 0x0007, 0x1007,
+			0x0008, 0x1008, 0x0009, 0x1009, 0x000a, 0x100a, 0x000b, 0x100b,
+			0x000c, 0x100c, 0x000d, 0x100d, 0x000e, 0x100e, 0x000f, 0x100f,
+			0x0010, 0x1010, 0x0011, 0x1011, 0x0012, 0x1012, 0x0013, 0x1013,
+			0x0014, 0x1014, 0x0015, 0x1015, 0x0016, 0x1016, 0x0017, 0x1017,
+			0x0018, 0x1018, 0x0019, 0x1019, 0x001a, 0x101a, 0x001b, 0x101b,
+			0x001c, 0x101c, 0x001d, 0x101d, 0x001e, 0x101e, 0x001f, 0x101f,
+			0x0020, 0x1020, 0x0021, 0x1021, 0x0022, 0x1022, 0x0023, 0x1023,
+			0x0024, 0x1024, 0x0025, 0x1025, 0x0026, 0x1026, 0x0027, 0x1027,
+			0x0028, 0x1028, 0x0029, 0x1029, 0x002a, 0x102a, 0x002b, 0x102b,
+			0x002c, 0x102c, 0x002d, 0x102d, 0x002e, 0x102e, 0x002f, 0x102f,
+			0x0030, 0x1030, 0x0031, 0x1031, 0x0032, 0x1032, 0x0033, 0x1033,
+			0x0034, 0x1034, 0x0035, 0x1035, 0x0036, 0x1036, 0x0037, 0x1037,
+			0x0038, 0x1038, 0x0039, 0x1039, 0x003a, 0x103a, 0x003b, 0x103b,
+			0x003c, 0x103c, 0x003d, 0x103d, 0x003e, 0x103e, 0x003f, 0x103f,
+			0x0040, 0x1040, 0x0041, 0x1041, 0x0042, 0x1042, 0x0043, 0x1043,
+			0x0044, 0x1044, 0x0045, 0x1045, 0x0046, 0x1046, 0x0047, 0x1047,
+			0x0048, 0x1048, 0x0049, 0x1049, 0x004a, 0x104a, 0x004b, 0x104b,
+			0x004c, 0x104c, 0x004d, 0x104d, 0x004e, 0x104e, 0x004f, 0x104f,
+			0x0050, 0x1050, 0x0051, 0x1051, 0x0052, 0x1052, 0x0053, 0x1053,
+			0x0054, 0x1054, 0x0055, 0x1055, 0x0056, 0x1056, 0x0057, 0x1057,
+			0x0058, 0x1058, 0x0059, 0x1059, 0x005a, 0x105a, 0x005b, 0x105b,
+			0x005c, 0x105c, 0x005d, 0x105d, 0x005e, 0x105e, 0x005f, 0x105f,
+			0x0060, 0x1060, 0x0061, 0x1061, 0x0062, 0x1062, 0x0063, 0x1063,
+			0x0064, 0x1064, 0x0065, 0x1065, 0x0066, 0x1066, 0x0067, 0x1067,
+			0x0068, 0x1068, 0x0069, 0x1069, 0x006a, 0x106a, 0x006b, 0x106b,
+			0x006c, 0x106c, 0x006d, 0x106d, 0x006e, 0x106e, 0x006f, 0x106f,
+			0x0070, 0x1070, 0x0071, 0x1071, 0x0072, 0x1072, 0x0073, 0x1073,
+			0x0074, 0x1074, 0x0075, 0x1075, 0x0076, 0x1076, 0x0077, 0x1077,
+			0x0078, 0x1078, 0x0079, 0x1079, 0x007a, 0x107a, 0x007b, 0x107b,
+			0x007c, 0x107c, 0x007d, 0x107d, 0x007e, 0x107e, 0x007f, 0x107f,
+		},
+	},
+};
@@ -0,0 +1,219 @@
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "block.h"
+#include "cpu.h"
+
+/* furthest a block can reach back from a written byte */
+#define BLOCK_BYTES (BLOCK_MAX * 3)
+
+static int
+ends_block(uint8_t opcode, const struct Instr *in)
+{
+	switch (opcode) {
+		/* jr, jp, call, ret, rst */
+		case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+		case 0xc2: case 0xc3: case 0xca: case 0xd2: case 0xda: case 0xe9:
+		case 0xc4: case 0xcc: case 0xcd: case 0xd4: case 0xdc:
+		case 0xc0: case 0xc8: case 0xc9: case 0xd0: case 0xd8: case 0xd9:
+		case 0xc7: case 0xcf: case 0xd7: case 0xdf:
+		case 0xe7: case 0xef: case 0xf7: case 0xff:
+		/* stop, halt, di, ei */
+		case 0x10: case 0x76: case 0xf3: case 0xfb:
+		/* io can raise or clear interrupts, stores through hl, bc or de raise SMC_IO */
+		case 0xe0: case 0xe2: case 0xf0: case 0xf2:
+			return 1;
+		case 0xea: case 0xfa:
+			return in->imm >= 0xff00;
+		default:
+			return in->fn == NULL;
+	}
+}
+
+struct Block *
+block_build(struct CPU *cpu, uint16_t pc, int max)
+{
+	struct Block *blk = malloc(sizeof(struct Block) + max * sizeof(struct Instr));
+	uint16_t adr = pc;
+	int window = cpu_code_window(pc);
+
+	if (blk == NULL)
+		return NULL;
+	blk->pc = pc;
+	blk->len = 0;
+
+	/*
+	 * the first instruction is always taken, the caller decided pc is fine.
+	 * the rest stay in the window of pc, the tables the block is kept in
+	 */
+	while (blk->len < max && (blk->len == 0
+			|| (cpu_cacheable(adr) && cpu_code_window(adr) == window))) {
+		struct Instr *in = &blk->instr[blk->len++];
+		uint8_t opcode = cpu_peek(cpu, adr);
+
+		/* only the copy leaves the block open, the rest end in a jr or io read */
+		if (cpu_fuse(cpu, adr, in, max - blk->len + 1)) {
+			adr += in->len;
+			if (in->opcode == FUSE_COPY)
+				continue;
+			break;
+		}
+
+		cpu_decode(cpu, adr, in);
+		if (blk->len > 1 && cpu_code_window(adr + in->len - 1) != window) {
+			blk->len--;
+			break;
+		}
+		adr += in->len;
+
+		if (opcode != 0xcb && ends_block(opcode, in))
+			break;
+	}
+	blk->end = adr;
+
+	return blk;
+}
+
+/* rom in a bank's tables is never written, so only the rest is counted */
+static void
+mark(struct CPU *cpu, const struct Block *blk, int n)
+{
+	for (uint16_t adr = blk->pc; adr != blk->end; adr++)
+		if (cpu_bank_code(cpu, adr) == NULL)
+			cpu->code[adr] += n;
+}
+
+/* where the block starting at pc is kept, the cpu has block tables */
+struct Block **
+block_at(struct CPU *cpu, uint16_t pc)
+{
+	struct BankCode *bc = cpu_bank_code(cpu, pc);
+
+	return bc != NULL ? &bc->blocks[pc % ROM_BANK] : &cpu->blocks[pc];
+}
+
+/* one instruction through the interpreter, timed like run */
+static int
+execute_one(struct CPU *cpu)
+{
+	int cycles = cpu_execute(cpu);
+	cpu->mcycles += cycles;
+	return cycles;
+}
+
+/* mcycles still advance per instruction, only interrupts wait for the block end */
+static int
+run(struct CPU *cpu, struct Block *blk, int timed)
+{
+	const struct Instr *end = &blk->instr[blk->len];
+	int cycles = 0;
+
+	cpu->cur_block = blk;
+	cpu->smc = 0;
+
+	/* fused instructions can stop short, so count what each one returns */
+	for (const struct Instr *in = blk->instr; in < end; in++) {
+		cpu->pc += in->len;
+		int n = CPU_CALL(cpu, in);
+		cycles += n;
+		if (timed)
+			cpu->mcycles += n;
+
+		/* the block rewrote itself, was banked out or wrote io, see enum SMC */
+		if (cpu->smc)
+			break;
+	}
+
+	cpu->cur_block = NULL;
+	if (cpu->smc & SMC_WRITTEN)
+		free(blk);
+
+	return cycles;
+}
+
+/*
+ * runs one block starting at pc, built from at most max instructions.
+ * cpus without block tables (tests) are not timed, same as cpu_execute
+ */
+int
+cpu_execute_block(struct CPU *cpu, int max)
+{
+	uint16_t pc = cpu->pc;
+
+	if (cpu->blocks == NULL) {
+		struct Block *blk = block_build(cpu, pc, max);
+		if (blk == NULL)
+			return cpu_execute(cpu);
+		int cycles = run(cpu, blk, 0);
+		if (!(cpu->smc & SMC_WRITTEN))
+			free(blk);
+		return cycles;
+	}
+
+	/* an instruction across two windows is never kept, see cpu_crosses */
+	if (!cpu_cacheable(pc) || (*block_at(cpu, pc) == NULL && cpu_crosses(cpu, pc)))
+		return execute_one(cpu);
+
+	struct Block *blk = *block_at(cpu, pc);
+	if (blk == NULL || blk->len > max) {
+		if (blk != NULL)
+			block_invalidate(cpu, pc);
+		if ((blk = block_build(cpu, pc, max)) == NULL)
+			return execute_one(cpu);
+		*block_at(cpu, pc) = blk;
+		mark(cpu, blk, 1);
+	}
+
+	return run(cpu, blk, 1);
+}
+
+void
+block_invalidate(struct CPU *cpu, uint16_t adr)
+{
+	for (int i = 0; i < BLOCK_BYTES; i++) {
+		uint16_t pc = adr - i;
+		struct Block *blk = *block_at(cpu, pc);
+
+		if (blk == NULL || (uint16_t)(adr - blk->pc) >= (uint16_t)(blk->end - blk->pc))
+			continue;
+
+		mark(cpu, blk, -1);
+		*block_at(cpu, pc) = NULL;
+
+		/* still running, freed once it stops */
+		if (blk == cpu->cur_block)
+			cpu->smc |= SMC_WRITTEN;
+		else
+			free(blk);
+	}
+}
+
+/* drops every block in blocks[0, n) */
+static void
+flush(struct CPU *cpu, struct Block **blocks, int n)
+{
+	for (int i = 0; i < n; i++) {
+		struct Block *blk = blocks[i];
+		if (blk == NULL)
+			continue;
+
+		mark(cpu, blk, -1);
+		blocks[i] = NULL;
+		if (blk == cpu->cur_block)
+			cpu->smc |= SMC_WRITTEN;
+		else
+			free(blk);
+	}
+}
+
+void
+block_flush(struct CPU *cpu)
+{
+	if (cpu->blocks == NULL)
+		return;
+
+	flush(cpu, cpu->blocks, 1 << 16);
+	for (int i = 0; i < 2 * ROM_BANKS_MAX; i++)
+		if (cpu->bank_code[i] != NULL)
+			flush(cpu, cpu->bank_code[i]->blocks, ROM_BANK);
+}
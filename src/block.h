@@ -0,0 +1,17 @@
+#include <stdint.h>
+#include "cpu.h"
+
+#define BLOCK_MAX 32
+
+/* straight-line run of decoded instructions, ends at the first branch */
+struct Block {
+	uint16_t pc, end;
+	uint8_t len;
+	struct Instr instr[];
+};
+
+struct Block **block_at(struct CPU *cpu, uint16_t pc);
+struct Block *block_build(struct CPU *cpu, uint16_t pc, int max);
+int cpu_execute_block(struct CPU *cpu, int max);
+void block_invalidate(struct CPU *cpu, uint16_t adr);
+void block_flush(struct CPU *cpu);
@@ -0,0 +1,191 @@
+/*
+ * Copy and fill loops (ld a,[hl+]; ld [de],a; inc de or ld [hl+],a, counted
+ * down with dec r8 or dec bc; ld a,b; or c) move one byte per iteration and
+ * their effect only depends on the count. The iterations up to the next
+ * event are done as one memmove or memset and charged their exact mcycles.
+ * The last iteration is left to the cpu so it sets the flags itself.
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "bulk.h"
+#include "cpu.h"
+
+enum {
+	COPY,
+	FILL,
+};
+
+struct Loop {
+	int kind;
+	int step; /* added to hl each iteration */
+	int iter; /* mcycles of an iteration that branches back */
+	int fill; /* loaded into a at the top, -1 when a is stored as is */
+	uint8_t *cnt; /* dec r8 counter, NULL for bc */
+};
+
+static uint8_t *
+counter(struct CPU *cpu, uint8_t op)
+{
+	switch (op) {
+		case 0x05: return &cpu->b;
+		case 0x0d: return &cpu->c;
+		case 0x15: return &cpu->d;
+		case 0x1d: return &cpu->e;
+		default: return NULL;
+	}
+}
+
+static int
+match(struct CPU *cpu, struct Loop *lp)
+{
+	uint16_t pc = cpu->pc;
+	uint8_t b[9];
+	int i = 0;
+
+	for (int j = 0; j < 9; j++)
+		b[j] = cpu_peek(cpu, pc + j);
+
+	*lp = (struct Loop){ .fill = -1 };
+
+	if (b[0] == 0x2a && b[1] == 0x12 && b[2] == 0x13) {
+		lp->kind = COPY;
+		lp->step = 1;
+		lp->iter = 6;
+		i = 3;
+	} else {
+		switch (b[0]) {
+			case 0xaf: lp->fill = 0; lp->iter = 1; i = 1; break; /* xor a */
+			case 0x3e: lp->fill = b[1]; lp->iter = 2; i = 2; break; /* ld a,n */
+			case 0x7a: lp->fill = cpu->d; lp->iter = 1; i = 1; break; /* ld a,d */
+			case 0x7b: lp->fill = cpu->e; lp->iter = 1; i = 1; break; /* ld a,e */
+		}
+		if (b[i] != 0x22 && b[i] != 0x32)
+			return 0;
+
+		lp->kind = FILL;
+		lp->step = b[i] == 0x22 ? 1 : -1;
+		lp->iter += 2;
+		i++;
+	}
+
+	if (b[i] == 0x0b && b[i + 1] == 0x78 && b[i + 2] == 0xb1) {
+		/* ld a,b; or c changes what the next iteration stores */
+		if (lp->kind == FILL && lp->fill < 0)
+			return 0;
+		lp->iter += 4;
+		i += 3;
+	} else if ((lp->cnt = counter(cpu, b[i])) != NULL) {
+		/* the counter can't also be an address or the fill value */
+		if (lp->kind == COPY && (lp->cnt == &cpu->d || lp->cnt == &cpu->e))
+			return 0;
+		if ((b[0] == 0x7a && lp->cnt == &cpu->d) || (b[0] == 0x7b && lp->cnt == &cpu->e))
+			return 0;
+		lp->iter += 1;
+		i++;
+	} else {
+		return 0;
+	}
+
+	/* jr nz back to the head */
+	if (b[i] != 0x20 || (uint16_t)(pc + i + 2 + (int8_t)b[i + 1]) != pc)
+		return 0;
+	lp->iter += 3;
+
+	return 1;
+}
+
+/*
+ * the host memory behind [adr, adr + n) if it is plain ram or rom in one run,
+ * no io, oam, echo ram, ie or mbc registers, else NULL
+ */
+static uint8_t *
+plain(const struct CPU *cpu, uint16_t adr, int n, uint16_t lo)
+{
+	const struct Bus *bus = cpu->bus;
+	uint32_t end = adr + n;
+	uint8_t *p = bus->rd[adr >> 8];
+
+	if (adr >= 0xFF80 && end <= 0xFFFF)
+		return &cpu->memory[adr];
+	if (adr < lo || end > 0xE000 || p == NULL)
+		return NULL;
+
+	/* a rom or ram bank only runs on within its window */
+	for (uint32_t i = adr >> 8; i <= (end - 1) >> 8; i++)
+		if (bus->rd[i] != p + ((i - (adr >> 8)) << 8))
+			return NULL;
+	return p + (adr & 0xff);
+}
+
+/*
+ * called when the cpu branched back to pc, returns the mcycles run in bulk
+ * (at most max), which the timer and ppu catch up on later
+ */
+int
+bulk_run(struct Bulk *bulk, struct CPU *cpu, int max)
+{
+	struct Loop lp;
+
+	if (cpu->halt || cpu->ime == IME_NEXT || !match(cpu, &lp))
+		return 0;
+
+	/* all but the last iteration, and none that would cross an event */
+	int n = lp.cnt ? (*lp.cnt ? *lp.cnt : 0x100) : (cpu->bc ? cpu->bc : 0x10000);
+	n--;
+
+	/* the copy may land in vram, so the ppu draws what came before it first */
+	cpu_catchup(cpu);
+	uint64_t event = sched_next(&cpu->sched) - cpu->mcycles;
+	int next = event <= (uint64_t)max ? (int)event : max + 1;
+	if ((next - 1) / lp.iter < n)
+		n = (next - 1) / lp.iter;
+	if (n <= 0)
+		return 0;
+
+	uint16_t src = cpu->hl;
+	uint16_t dst = lp.kind == COPY ? cpu->de : lp.step > 0 ? cpu->hl : cpu->hl - (n - 1);
+	uint8_t *d = plain(cpu, dst, n, 0x8000);
+	const uint8_t *s = lp.kind == COPY ? plain(cpu, src, n, 0) : NULL;
+
+	if (d == NULL || (lp.kind == COPY && s == NULL))
+		return 0;
+
+	if (lp.kind == COPY) {
+		/* the byte loop repeats a pattern when dst is just ahead of src */
+		if (dst > src && dst < src + n) {
+			for (int i = 0; i < n; i++)
+				d[i] = s[i];
+		} else {
+			memmove(d, s, n);
+		}
+		cpu->a = d[n - 1];
+		cpu->de += n;
+	} else {
+		if (lp.fill >= 0)
+			cpu->a = lp.fill;
+		memset(d, cpu->a, n);
+	}
+	cpu->hl += lp.step * n;
+	cpu_invalidate(cpu, dst, n);
+
+	/* flags as the counter left them, still nonzero */
+	cpu_sync_flags(cpu);
+	if (lp.cnt != NULL) {
+		*lp.cnt -= n;
+		cpu->f.z = 0;
+		cpu->f.n = 1;
+		cpu->f.h = (*lp.cnt & 0xf) == 0xf;
+	} else {
+		cpu->bc -= n;
+		cpu->a = cpu->b | cpu->c;
+		cpu->f.flags = 0;
+	}
+
+	int cycles = n * lp.iter;
+	cpu->mcycles += cycles;
+	bulk->bytes += n;
+	bulk->mcycles += cycles;
+
+	return cycles;
+}
@@ -0,0 +1,12 @@
+#ifndef BULK_H
+#define BULK_H
+#include <stdint.h>
+#include "cpu.h"
+
+struct Bulk {
+	uint64_t bytes; /* moved without running the loop */
+	uint64_t mcycles;
+};
+
+int bulk_run(struct Bulk *bulk, struct CPU *cpu, int max);
+#endif /* BULK_H */
@@ -0,0 +1,403 @@
+/*
+ * The cartridge owns the rom and ram images, the bus only points into them.
+ * Writes to 0000-7fff set the mbc registers and a bank switch moves the
+ * pointers of the pages in the 0000-3fff, 4000-7fff and a000-bfff windows,
+ * nothing is copied.
+ */
+#define _DEFAULT_SOURCE /* MAP_ANONYMOUS */
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "cart.h"
+#include "cpu.h"
+
+enum {
+	CART_TYPE = 0x147,
+	CART_ROM_SIZE = 0x148,
+	CART_RAM_SIZE = 0x149,
+	CART_HEADER_END = 0x150,
+};
+
+static int
+mbc(uint8_t type)
+{
+	switch (type) {
+		case 0x00: /* rom only */
+		case 0x08: /* rom+ram */
+		case 0x09: /* rom+ram+battery */
+			return MBC_NONE;
+		case 0x01:
+		case 0x02:
+		case 0x03:
+			return MBC_1;
+		case 0x0f:
+		case 0x10:
+		case 0x11:
+		case 0x12:
+		case 0x13:
+			return MBC_3;
+		case 0x19:
+		case 0x1a:
+		case 0x1b:
+		case 0x1c:
+		case 0x1d:
+		case 0x1e:
+			return MBC_5;
+		default:
+			return -1;
+	}
+}
+
+static int
+battery(uint8_t type)
+{
+	switch (type) {
+		case 0x03:
+		case 0x09:
+		case 0x0f:
+		case 0x10:
+		case 0x13:
+		case 0x1b:
+		case 0x1e:
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/* by header byte 0x149, all powers of two. the 2K of size 1 is mirrored over a000-bfff */
+static const size_t ram_sizes[] = { 0, 0x800, 0x2000, 0x8000, 0x20000, 0x10000 };
+
+/* the whole image in one read, for when it can't be mapped */
+static uint8_t *
+read_rom(int fd, size_t size)
+{
+	uint8_t *rom = malloc(size);
+	size_t n = 0;
+
+	while (rom != NULL && n < size) {
+		ssize_t r = pread(fd, rom + n, size - n, n);
+		if (r <= 0) {
+			free(rom);
+			return NULL;
+		}
+		n += r;
+	}
+	return rom;
+}
+
+/* game.gb keeps its battery backed ram in game.sav */
+static char *
+sav_path(const char *path)
+{
+	const char *dot = strrchr(path, '.');
+	const char *slash = strrchr(path, '/');
+	size_t n = dot != NULL && (slash == NULL || dot > slash) ? (size_t)(dot - path) : strlen(path);
+	char *sav = malloc(n + sizeof(".sav"));
+
+	if (sav == NULL)
+		return NULL;
+	memcpy(sav, path, n);
+	strcpy(sav + n, ".sav");
+	return sav;
+}
+
+/*
+ * battery backed ram is the save file itself, mapped shared, so what the game
+ * wrote is in the page cache even if the emulator dies. any other ram, or if
+ * the file can't be had, is anonymous memory. returns whether the file
+ * already had a clock footer
+ */
+static int
+map_sav(struct Cart *cart, const char *path)
+{
+	int footer = 0;
+	char *sav = battery(cart->type) ? sav_path(path) : NULL;
+
+	if (sav != NULL) {
+		struct stat st;
+		int fd = open(sav, O_RDWR | O_CREAT, 0644);
+
+		/* the file may be longer, it is only ever grown */
+		if (fd >= 0 && fstat(fd, &st) == 0
+				&& ((size_t)st.st_size >= cart->sav_size || ftruncate(fd, cart->sav_size) == 0)) {
+			cart->sav = mmap(NULL, cart->sav_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			cart->saved = cart->sav != MAP_FAILED;
+			footer = (size_t)st.st_size >= cart->ram_size + RTC_FOOTER - 4;
+		}
+		if (!cart->saved)
+			fprintf(stderr, "unable to map %s, the game won't be saved\n", sav);
+		if (fd >= 0)
+			close(fd);
+		free(sav);
+		if (cart->saved)
+			return footer;
+	}
+
+	cart->sav = mmap(NULL, cart->sav_size, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (cart->sav == MAP_FAILED)
+		cart->sav = NULL;
+	return 0;
+}
+
+/*
+ * the rom is mapped read only and shared, so loading costs the same for any
+ * size and every instance running the same file uses the same pages
+ */
+struct Cart *
+cart_load(const char *path)
+{
+	uint8_t header[CART_HEADER_END];
+	struct stat st;
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		fprintf(stderr, "unable to open rom: %s\n", path);
+		return NULL;
+	}
+
+	if (fstat(fd, &st) < 0 || pread(fd, header, sizeof(header), 0) != sizeof(header)) {
+		fprintf(stderr, "not a rom: %s\n", path);
+		goto fail;
+	}
+
+	/* 32K times a power of two, and the file has to hold all of it */
+	if (header[CART_ROM_SIZE] > 8) {
+		fprintf(stderr, "bad rom size 0x%02x in header: %s\n", header[CART_ROM_SIZE], path);
+		goto fail;
+	}
+	size_t size = (size_t)2 * ROM_BANK << header[CART_ROM_SIZE];
+	if ((size_t)st.st_size < size) {
+		fprintf(stderr, "rom is %lld bytes, its header says %zu: %s\n",
+			(long long)st.st_size, size, path);
+		goto fail;
+	}
+
+	int m = mbc(header[CART_TYPE]);
+	if (m < 0) {
+		fprintf(stderr, "unsupported cartridge type 0x%02x: %s\n", header[CART_TYPE], path);
+		goto fail;
+	}
+
+	struct Cart *cart = calloc(1, sizeof(struct Cart));
+	if (cart == NULL) {
+		fprintf(stderr, "out of memory for the cartridge: %s\n", path);
+		goto fail;
+	}
+	cart->type = header[CART_TYPE];
+	cart->mbc = m;
+	cart->rom_size = size;
+	cart->rom = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+	cart->mapped = cart->rom != MAP_FAILED;
+	if (!cart->mapped && (cart->rom = read_rom(fd, size)) == NULL) {
+		fprintf(stderr, "unable to read rom: %s\n", path);
+		free(cart);
+		goto fail;
+	}
+	close(fd);
+
+	uint8_t ram = header[CART_RAM_SIZE];
+	if (ram < sizeof(ram_sizes) / sizeof(ram_sizes[0]))
+		cart->ram_size = ram_sizes[ram];
+	cart->clock = cart->type == 0x0f || cart->type == 0x10;
+	cart->sav_size = cart->ram_size + (cart->clock ? RTC_FOOTER : 0);
+	if (cart->sav_size > 0) {
+		int footer = map_sav(cart, path);
+		if (cart->sav != NULL && cart->ram_size > 0)
+			cart->ram = cart->sav;
+		if (cart->clock)
+			rtc_init(&cart->rtc, cart->sav != NULL ? cart->sav + cart->ram_size : NULL, footer);
+	}
+
+	cart->rom_bank = 1;
+	cart->ram_on = cart->mbc == MBC_NONE;
+
+	return cart;
+
+fail:
+	close(fd);
+	return NULL;
+}
+
+/* battery backed ram is written out now rather than whenever the kernel likes */
+void
+cart_sync(const struct Cart *cart)
+{
+	if (cart->saved)
+		msync(cart->sav, cart->sav_size, MS_SYNC);
+}
+
+void
+cart_free(struct Cart *cart)
+{
+	if (cart->mapped)
+		munmap(cart->rom, cart->rom_size);
+	else
+		free(cart->rom);
+	if (cart->sav != NULL) {
+		cart_sync(cart);
+		munmap(cart->sav, cart->sav_size);
+	}
+	free(cart);
+}
+
+/* a000-bfff without ram, or with it disabled */
+static uint8_t
+ram_off_read(struct CPU *cpu, uint16_t adr)
+{
+	(void)cpu;
+	(void)adr;
+	return 0xff;
+}
+
+static void
+ram_off_write(struct CPU *cpu, uint16_t adr, uint8_t data)
+{
+	(void)cpu;
+	(void)adr;
+	(void)data;
+}
+
+/* a000-bfff with an mbc3 clock register selected */
+static uint8_t
+clock_read(struct CPU *cpu, uint16_t adr)
+{
+	(void)adr;
+	return rtc_read(&cpu->cart->rtc, cpu->cart->ram_bank - 8);
+}
+
+static void
+clock_write(struct CPU *cpu, uint16_t adr, uint8_t data)
+{
+	(void)adr;
+	rtc_write(&cpu->cart->rtc, cpu->cart->ram_bank - 8, data, cpu->mcycles);
+}
+
+/* point the bank windows at what the registers select */
+static void
+remap(const struct Cart *cart, struct Bus *bus)
+{
+	size_t lo = 0, hi = cart->rom_bank, ram = cart->ram_bank;
+
+	if (cart->mbc == MBC_1) {
+		hi |= cart->ram_bank << 5;
+		if (cart->mode)
+			lo = cart->ram_bank << 5;
+		else
+			ram = 0;
+	}
+	lo &= cart->rom_size / ROM_BANK - 1;
+	hi &= cart->rom_size / ROM_BANK - 1;
+
+	for (int i = 0; i < ROM_BANK >> 8; i++) {
+		bus->rd[i] = &cart->rom[lo * ROM_BANK + (i << 8)];
+		bus->rd[0x40 + i] = &cart->rom[hi * ROM_BANK + (i << 8)];
+	}
+
+	/* mbc3 selects its clock with banks 8-c */
+	int rtc = cart->mbc == MBC_3 && ram > 3;
+	int on = cart->ram != NULL && cart->ram_on && !rtc;
+	int clock = cart->clock && cart->ram_on && rtc && ram <= 0xc;
+
+	for (int i = 0xa0; i < 0xc0; i++) {
+		size_t off = (ram * RAM_BANK + ((i - 0xa0) << 8)) & (cart->ram_size - 1);
+		uint8_t *p = on ? &cart->ram[off] : NULL;
+		bus->rd[i] = bus->wr[i] = p;
+		bus->read[i] = clock ? clock_read : ram_off_read;
+		bus->write[i] = clock ? clock_write : ram_off_write;
+	}
+}
+
+/* 0000-7fff, the mbc registers */
+static void
+cart_write(struct CPU *cpu, uint16_t adr, uint8_t data)
+{
+	struct Cart *cart = cpu->cart;
+	struct Bus *bus = cpu->bus;
+	const uint8_t *lo = bus->rd[0x00], *hi = bus->rd[0x40];
+
+	switch (cart->mbc) {
+		case MBC_NONE:
+			return;
+		case MBC_1:
+			if (adr < 0x2000)
+				cart->ram_on = (data & 0xf) == 0xa;
+			else if (adr < 0x4000)
+				cart->rom_bank = (data & 0x1f) ? (data & 0x1f) : 1;
+			else if (adr < 0x6000)
+				cart->ram_bank = data & 0x3;
+			else
+				cart->mode = data & 0x1;
+			break;
+		case MBC_3:
+			if (adr < 0x2000)
+				cart->ram_on = (data & 0xf) == 0xa;
+			else if (adr < 0x4000)
+				cart->rom_bank = (data & 0x7f) ? (data & 0x7f) : 1;
+			else if (adr < 0x6000)
+				cart->ram_bank = data;
+			else if (cart->clock)
+				rtc_latch(&cart->rtc, data, cpu->mcycles);
+			break;
+		case MBC_5:
+			if (adr < 0x2000)
+				cart->ram_on = (data & 0xf) == 0xa;
+			else if (adr < 0x3000)
+				cart->rom_bank = (cart->rom_bank & 0x100) | data;
+			else if (adr < 0x4000)
+				cart->rom_bank = (cart->rom_bank & 0xff) | (data & 0x1) << 8;
+			else if (adr < 0x6000)
+				cart->ram_bank = data & 0xf;
+			break;
+	}
+
+	remap(cart, bus);
+	if (bus->rd[0x00] != lo)
+		cpu_rom_mapped(cpu, 0, cart_bank(cpu, 0x0000));
+	if (bus->rd[0x40] != hi)
+		cpu_rom_mapped(cpu, 1, cart_bank(cpu, 0x4000));
+}
+
+/* the clock runs on emulated time, see rtc_emulated */
+void
+cart_deterministic(struct Cart *cart)
+{
+	if (cart->clock)
+		rtc_emulated(&cart->rtc);
+}
+
+/* the rom bank mapped at adr, -1 outside 0000-7fff or without a cartridge */
+int
+cart_bank(const struct CPU *cpu, uint16_t adr)
+{
+	const struct Cart *cart = cpu->cart;
+
+	if (cart == NULL || adr >= 0x8000)
+		return -1;
+	return (cpu->bus->rd[adr >> 8] - cart->rom) / ROM_BANK;
+}
+
+/* the cartridge's pages on cpu's bus, from now on it handles 0000-7fff and a000-bfff */
+void
+cart_insert(struct Cart *cart, struct CPU *cpu)
+{
+	struct Bus *bus = cpu->bus;
+
+	/* what was decoded from the flat rom goes, each bank keeps its own from here */
+	cpu_invalidate(cpu, 0x0000, 2 * ROM_BANK);
+	cpu->cart = cart;
+	for (int i = 0; i < 0x80; i++) {
+		bus->wr[i] = NULL;
+		bus->write[i] = cart_write;
+	}
+	remap(cart, bus);
+	cpu_rom_mapped(cpu, 0, cart_bank(cpu, 0x0000));
+	cpu_rom_mapped(cpu, 1, cart_bank(cpu, 0x4000));
+}
@@ -0,0 +1,50 @@
+#ifndef CART_H
+#define CART_H
+#include <stddef.h>
+#include <stdint.h>
+#include "rtc.h"
+
+struct CPU;
+
+enum MBC {
+	MBC_NONE,
+	MBC_1,
+	MBC_3,
+	MBC_5,
+};
+
+enum {
+	ROM_BANK = 0x4000,
+	RAM_BANK = 0x2000,
+	ROM_BANKS_MAX = 512, /* 8M, the largest size a header can give */
+	RAM_BANKS_MAX = 16, /* 128K */
+};
+
+/* the rom and ram of a cartridge and the registers of its mbc */
+struct Cart {
+	uint8_t *rom; /* mapped from the file, read only */
+	uint8_t *sav; /* ram then the clock, mapped from the .sav file with a battery */
+	uint8_t *ram; /* the start of sav, NULL without ram */
+	size_t rom_size; /* as the header says, at least two banks */
+	size_t ram_size; /* 2K or whole banks, if there is ram */
+	size_t sav_size;
+	uint8_t type; /* header byte 0x147 */
+	enum MBC mbc;
+	uint8_t mapped; /* rom is from mmap, else malloc */
+	uint8_t saved; /* sav is the .sav file */
+	uint8_t clock; /* an mbc3 with the rtc */
+	struct RTC rtc;
+
+	uint16_t rom_bank; /* mbc1 only keeps the low 5 bits here */
+	uint8_t ram_bank; /* mbc1 the high 2 bits of either bank */
+	uint8_t ram_on;
+	uint8_t mode; /* mbc1, ram_bank also applies to 0000-3fff and the ram */
+};
+
+struct Cart *cart_load(const char *path);
+void cart_sync(const struct Cart *cart);
+void cart_free(struct Cart *cart);
+void cart_insert(struct Cart *cart, struct CPU *cpu);
+void cart_deterministic(struct Cart *cart);
+int cart_bank(const struct CPU *cpu, uint16_t adr);
+#endif /* CART_H */
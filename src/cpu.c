@@ -1,9 +1,19 @@
 #include <assert.h>
+#include <limits.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "alu.h"
+#include "block.h"
 #include "cpu.h"
+#include "interrupt.h"
+#include "joypad.h"
+#ifdef JIT
+#include "jit.h"
+#endif
 #include "mem.h"
 #include "opcode.h"
 #include "timer.h"
@@ -30,2101 +40,1752 @@ init_cpu(uint8_t *mem) {
 
 	cpu->sp = 0xFFFE;
 
-	if (mem != NULL)
+	if (mem != NULL) {
 		cpu->memory = mem;
+		cpu->bus = malloc(sizeof(struct Bus));
+		cpu_map(cpu->bus, mem);
+	}
 
-	cpu->log = fopen("cpu.log", "w");
+	cpu->icache = calloc(1 << 16, sizeof(struct Instr));
+	cpu->blocks = calloc(1 << 16, sizeof(struct Block *));
+	cpu->code = calloc(1 << 16, sizeof(uint8_t));
+	cpu->bank_code = calloc(2 * ROM_BANKS_MAX, sizeof(struct BankCode *));
+#ifdef JIT
+	cpu->jit = jit_init();
+#endif
+#ifdef OPSTATS
+	cpu->opstats = calloc(1, sizeof(struct OpStats));
+#endif
 
 	return cpu;
 }
 
-/* parse r8 used from lowest bit position */
-static uint8_t *
-parse_r8(struct CPU *cpu, uint8_t opcode, uint8_t bit)
+/* frees the code tables of cpu, not its memory or bus */
+void
+cpu_free_tables(struct CPU *cpu)
+{
+	block_flush(cpu);
+	if (cpu->bank_code != NULL)
+		for (int i = 0; i < 2 * ROM_BANKS_MAX; i++)
+			free(cpu->bank_code[i]);
+	free(cpu->bank_code);
+	free(cpu->icache);
+	free(cpu->blocks);
+	free(cpu->code);
+#ifdef JIT
+	jit_free(cpu->jit);
+	cpu->jit = NULL;
+#endif
+#ifdef OPSTATS
+	free(cpu->opstats);
+	cpu->opstats = NULL;
+#endif
+	cpu->bank_code = NULL;
+	cpu->rom_code[0] = cpu->rom_code[1] = NULL;
+	cpu->icache = NULL;
+	cpu->blocks = NULL;
+	cpu->code = NULL;
+}
+
+/* r8 operands are decoded to their offset in struct CPU */
+enum {
+	R8_HL = 0xff, /* [hl] */
+};
+
+static const uint8_t r8off[8] = {
+	[b] = offsetof(struct CPU, b),
+	[c] = offsetof(struct CPU, c),
+	[d] = offsetof(struct CPU, d),
+	[e] = offsetof(struct CPU, e),
+	[h] = offsetof(struct CPU, h),
+	[l] = offsetof(struct CPU, l),
+	[m] = R8_HL,
+	[a] = offsetof(struct CPU, a),
+};
+
+static const uint8_t r16off[4] = {
+	[bc] = offsetof(struct CPU, bc),
+	[de] = offsetof(struct CPU, de),
+	[hl] = offsetof(struct CPU, hl),
+	[sp] = offsetof(struct CPU, sp),
+};
+
+static const uint8_t r16memoff[4] = {
+	[bc] = offsetof(struct CPU, bc),
+	[de] = offsetof(struct CPU, de),
+	[hli] = offsetof(struct CPU, hl),
+	[hld] = offsetof(struct CPU, hl),
+};
+
+static const uint8_t r16stkoff[4] = {
+	[s_bc] = offsetof(struct CPU, bc),
+	[s_de] = offsetof(struct CPU, de),
+	[s_hl] = offsetof(struct CPU, hl),
+	[s_af] = offsetof(struct CPU, af),
+};
+
+/* the pair in bits 4-5 of opcode, off is one of the tables above */
+static uint16_t *
+r16(struct CPU *cpu, const uint8_t *off, uint8_t opcode)
+{
+	return (uint16_t *)((uint8_t *)cpu + off[opcode >> 4 & 0b11]);
+}
+
+/* where the instruction at pc is cached, the cpu has an icache */
+static struct Instr *
+icache_at(struct CPU *cpu, uint16_t pc)
+{
+	struct BankCode *bc = cpu_bank_code(cpu, pc);
+
+	return bc != NULL ? &bc->icache[pc % ROM_BANK] : &cpu->icache[pc];
+}
+
+/* drop any cached instruction that covers adr */
+static void
+invalidate(struct CPU *cpu, uint16_t adr)
 {
-	switch ((opcode >> bit) & 7) {
-		case b:
-			return &cpu->b;
-			break;
-		case c:
-			return &cpu->c;
-			break;
-		case d:
-			return &cpu->d;
-			break;
-		case e:
-			return &cpu->e;
-			break;
-		case h:
-			return &cpu->h;
-			break;
-		case l:
-			return &cpu->l;
-			break;
-		case m:
-			return &cpu->memory[cpu->h << 8 | cpu->l];
-			break;
-		case a:
-			return &cpu->a;
-			break;
-		default: /* should be unreachable */
-			assert(NULL);
-			break;
-	};
+	if (cpu->icache != NULL) {
+		for (int i = 0; i < 3; i++)
+			icache_at(cpu, adr - i)->fn = NULL;
+	}
+
+	if (cpu->code != NULL && cpu->code[adr]) {
+		block_invalidate(cpu, adr);
+#ifdef JIT
+		if (cpu->jit != NULL)
+			jit_invalidate(cpu, adr);
+#endif
+	}
 }
 
+/*
+ * ff00-ff7f and ie, a read and a write handler per register. the timer and
+ * ppu only write io registers and only read video memory, so a register
+ * either of them changes is caught up on before it is read and one they use
+ * before it is written. a register without a handler is plain storage and
+ * costs no more than hram
+ */
+enum {
+	IO_IE = 0x80, /* after the io page in the tables */
+	IO_REGS,
+};
 
-static void
-set_hc(struct CPU *cpu, uint8_t a, uint8_t b)
+/* the slot of adr in the tables, -1 for hram */
+static int
+io_reg(uint16_t adr)
 {
-	cpu->f.h = (((a & 0xF) + (b & 0xF)) & 0x10) == 0x10;
-	cpu->f.c = (((a & 0xFF) + (b & 0xFF)) & 0x100) == 0x100;
+#ifndef TEST
+	if (adr < 0xff80)
+		return adr & 0x7f;
+	return adr == IE ? IO_IE : -1;
+#else
+	return (void)adr, -1; /* the sm83 tests run on flat memory */
+#endif
 }
 
-static uint16_t
-pop(struct CPU *cpu, uint8_t *h, uint8_t *l)
-{
-	cpu->sp += 2;
-	if (h != NULL)
-		*h = mem_read(cpu->memory, cpu->sp - 1);
-	if (l != NULL)
-		*l = mem_read(cpu->memory, cpu->sp - 2);
+enum {
+	SERIAL_MCYCLES = 8 * 128, /* a byte at 8192 Hz */
+	DMA_MCYCLES = 160,
+};
 
-	return mem_read(cpu->memory, cpu->sp - 1) << 8 | mem_read(cpu->memory, cpu->sp - 2);
+/* changed by the timer, the ppu or an event while the cpu wasn't looking */
+static uint8_t
+sync_read(struct CPU *cpu, uint16_t adr)
+{
+	cpu_catchup(cpu);
+	return cpu->memory[adr];
 }
 
+/* used by the timer or ppu, which had the old value up to now */
 static void
-push(struct CPU *cpu, uint8_t h, uint8_t l)
+sync_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	mem_write(cpu->memory, --cpu->sp, h);
-	mem_write(cpu->memory, --cpu->sp, l);
+	cpu_catchup(cpu);
+	cpu->memory[adr] = data;
 }
 
-
+/* as sync_write, and the next timer or ppu interrupt may have moved */
 static void
-add(struct CPU *cpu, uint8_t n)
+resched_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	set_hc(cpu, cpu->a, n);
-	cpu->f.n = 0;
+	sync_write(cpu, adr, data);
+	cpu_catchup(cpu);
+}
 
-	cpu->a += n;
-	cpu->f.z = cpu->a == 0;
+/* the low nibble is the buttons of the selected group */
+static uint8_t
+joyp_read(struct CPU *cpu, uint16_t adr)
+{
+	(void)adr;
+	return read_input(cpu->memory[JOYP]);
 }
 
+/* a transfer on the internal clock ends by itself, see serial_done */
 static void
-adc(struct CPU *cpu, uint8_t n)
+sc_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	uint16_t ans = cpu->a + n + cpu->f.c;
-	uint8_t half_ans = (cpu->a & 0xf) + (n & 0xf) + cpu->f.c;
-
-	cpu->a = ans;
-
-	cpu->f.z = (cpu->a == 0);
-	cpu->f.c = ans > 0xff;
-	cpu->f.n = 0;
-	cpu->f.h = half_ans > 0xf;
+	sync_write(cpu, adr, data);
+	if (data == 0x81)
+		mem_serial(cpu->memory);
+	if ((data & 0x81) == 0x81)
+		sched_set(&cpu->sched, EVENT_SERIAL, cpu->mcycles + SERIAL_MCYCLES);
 }
 
+/* any write clears the divider, which may tick TIMA */
 static void
-sub(struct CPU *cpu, uint8_t n)
+div_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	cpu->f.c = n > cpu->a;
-	cpu->f.n = 1;
-	cpu->f.h = (cpu->a & 0xf) < (n & 0xf);
+	(void)data;
+	cpu_catchup(cpu);
+	timer_written(cpu, adr, cpu->memory[DIV]);
+	cpu_catchup(cpu);
+}
 
+static void
+tac_write(struct CPU *cpu, uint16_t adr, uint8_t data)
+{
+	cpu_catchup(cpu);
+	uint8_t old = cpu->memory[TAC];
+	cpu->memory[TAC] = data;
+	timer_written(cpu, adr, old);
+	cpu_catchup(cpu);
+}
 
-	cpu->a -= n;
-	cpu->f.z = (cpu->a == 0);
+/* the top three bits aren't there and read as ones */
+static uint8_t
+if_read(struct CPU *cpu, uint16_t adr)
+{
+	return sync_read(cpu, adr) | (uint8_t)~INTERRUPT_MASK;
 }
 
+/* requests raised before now are in IF first, so the write can clear them */
 static void
-sbc(struct CPU *cpu, uint8_t n)
+if_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	uint8_t res = cpu->a - n - cpu->f.c;
-
-	cpu->f.h = (cpu->a & 0xf) < ((n & 0xf) + (cpu->f.c));
-	cpu->f.c = n + cpu->f.c > cpu->a;
-	cpu->f.n = 1;
+	sync_write(cpu, adr, data & INTERRUPT_MASK);
+}
 
-	cpu->a = res;
-	cpu->f.z = (cpu->a == 0);
+static uint8_t
+stat_read(struct CPU *cpu, uint16_t adr)
+{
+	return sync_read(cpu, adr) | 0x80;
 }
 
+/* only the interrupt selects, the mode and LY=LYC bits are the ppu's */
 static void
-and(struct CPU *cpu, uint8_t n)
+stat_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	cpu->a &= n;
+	(void)adr;
+	cpu_catchup(cpu);
+	cpu->memory[STAT] = (cpu->memory[STAT] & 0x07) | (data & 0x78);
+	if (cpu->ppu != NULL)
+		ppu_stat_written(cpu->ppu);
+	cpu_catchup(cpu);
+}
 
-	cpu->f.z = (cpu->a == 0);
-	cpu->f.n = 0;
-	cpu->f.h = 1;
-	cpu->f.c = 0;
+/* may start or end LY=LYC on the current line */
+static void
+lyc_write(struct CPU *cpu, uint16_t adr, uint8_t data)
+{
+	sync_write(cpu, adr, data);
+	if (cpu->ppu != NULL)
+		ppu_stat_written(cpu->ppu);
+	cpu_catchup(cpu);
 }
 
+/* read only, the ppu counts it */
 static void
-xor(struct CPU *cpu, uint8_t n)
+ly_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	cpu->a ^= n;
+	(void)cpu;
+	(void)adr;
+	(void)data;
+}
 
-	cpu->f.z = (cpu->a == 0);
-	cpu->f.n = 0;
-	cpu->f.h = 0;
-	cpu->f.c = 0;
+/* the copy lands in one go, see dma_done */
+static void
+dma_write(struct CPU *cpu, uint16_t adr, uint8_t data)
+{
+	sync_write(cpu, adr, data);
+	sched_set(&cpu->sched, EVENT_DMA, cpu->mcycles + DMA_MCYCLES);
+}
+
+#define IO(adr) [(adr) & 0x7f]
+
+static uint8_t (*const io_reads[IO_REGS])(struct CPU *cpu, uint16_t adr) = {
+	IO(JOYP) = joyp_read,
+	IO(SB) = sync_read,
+	IO(SC) = sync_read,
+	IO(DIV) = sync_read,
+	IO(TIMA) = sync_read,
+	IO(IF) = if_read,
+	IO(STAT) = stat_read,
+	IO(LY) = sync_read,
+};
+
+static void (*const io_writes[IO_REGS])(struct CPU *cpu, uint16_t adr, uint8_t data) = {
+	IO(SB) = sync_write,
+	IO(SC) = sc_write,
+	IO(DIV) = div_write,
+	IO(TIMA) = resched_write,
+	IO(TMA) = sync_write,
+	IO(TAC) = tac_write,
+	IO(IF) = if_write,
+	IO(LCDC) = resched_write,
+	IO(STAT) = stat_write,
+	IO(SCY) = sync_write,
+	IO(SCX) = sync_write,
+	IO(LY) = ly_write,
+	IO(LYC) = lyc_write,
+	IO(DMA) = dma_write,
+	IO(BGP) = sync_write,
+	IO(OBP0) = sync_write,
+	IO(OBP1) = sync_write,
+	IO(WY) = sync_write,
+	IO(WX) = sync_write,
+	/* IE is checked before every instruction anyway */
+};
+
+#undef IO
+
+/* ff00-ffff, io registers, hram and ie */
+static uint8_t
+io_read(struct CPU *cpu, uint16_t adr)
+{
+	int reg = io_reg(adr);
+
+	if (reg >= 0 && io_reads[reg] != NULL)
+		return io_reads[reg](cpu, adr);
+	return cpu->memory[adr];
 }
 
 static void
-or(struct CPU *cpu, uint8_t n)
+io_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	cpu->a |= n;
+	int reg = io_reg(adr);
 
-	cpu->f.z = (cpu->a == 0);
-	cpu->f.n = 0;
-	cpu->f.h = 0;
-	cpu->f.c = 0;
+	/* ldh ends a block when built, a store through a register pair only here */
+	if (reg >= 0)
+		cpu->smc |= SMC_IO;
+	if (reg >= 0 && io_writes[reg] != NULL) {
+		io_writes[reg](cpu, adr, data);
+		return;
+	}
+	cpu->memory[adr] = data;
+	invalidate(cpu, adr);
 }
 
+/* vram and oam, which the ppu reads */
 static void
-cp(struct CPU *cpu, uint8_t n)
+video_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	uint8_t res = cpu->a - n;
-
-	cpu->f.z = (res == 0);
-	cpu->f.n = 1;
-	cpu->f.h = (cpu->a & 0xf) < (n & 0xf);
-	cpu->f.c = cpu->a < n;
+	cpu_catchup(cpu);
+	cpu->memory[adr] = data;
 }
 
+/* 0000-7fff, dropped until there is an mbc to tell */
 static void
-set_zn(struct CPU *cpu, uint8_t reg, uint8_t n)
+rom_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	cpu->f.n = n;
-	cpu->f.z = (reg == 0);
+	(void)cpu;
+	(void)adr;
+	(void)data;
 }
 
+/* ram with decoded instructions in it, see watch */
 static void
-jp(struct CPU *cpu, uint8_t h, uint8_t l)
+code_write(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	cpu->pc = h << 8 | l;
+	cpu->memory[adr] = data;
+	invalidate(cpu, adr);
 }
 
+/* the page holding adr has decoded instructions, writes to it go through code_write from now on */
 static void
-call(struct CPU *cpu, uint8_t h, uint8_t l)
+watch(struct CPU *cpu, uint16_t adr)
 {
-	cpu->pc += 2;
-	push(cpu, cpu->pc >> 8, cpu->pc & 0xff);
+	struct Bus *bus = cpu->bus;
 
-	cpu->pc = h << 8 | l;
+	if (bus->wr[adr >> 8] != NULL) {
+		bus->wr[adr >> 8] = NULL;
+		bus->write[adr >> 8] = code_write;
+	}
 }
 
-static int
-inc_r16(struct CPU *cpu, uint8_t opcode)
+/* every page plain memory except the ones with a handler above */
+void
+cpu_map(struct Bus *bus, uint8_t *mem)
 {
-	set_regs_r16(0b00110000, 4)
+	for (int i = 0; i < 0x100; i++) {
+		bus->rd[i] = bus->wr[i] = &mem[i << 8];
+		bus->read[i] = NULL;
+		bus->write[i] = code_write;
+	}
 
-	reg++;
+	bus->rd[0xff] = bus->wr[0xff] = NULL;
+	bus->read[0xff] = io_read;
+	bus->write[0xff] = io_write;
+#ifndef TEST
+	for (int i = 0x00; i < 0x80; i++) {
+		bus->wr[i] = NULL;
+		bus->write[i] = rom_write;
+	}
+	for (int i = 0x80; i < 0xa0; i++) {
+		bus->wr[i] = NULL;
+		bus->write[i] = video_write;
+	}
+	bus->wr[0xfe] = NULL;
+	bus->write[0xfe] = video_write;
+#endif
+}
 
-	set_r8_from_r16()
+static uint8_t
+read8(struct CPU *cpu, uint16_t adr)
+{
+	const uint8_t *p = cpu->bus->rd[adr >> 8];
 
-	return 2;
+	if (p != NULL)
+		return p[adr & 0xff];
+	return cpu->bus->read[adr >> 8](cpu, adr);
 }
 
-static int
-dec_r16(struct CPU *cpu, uint8_t opcode)
+static void
+write8(struct CPU *cpu, uint16_t adr, uint8_t data)
 {
-	set_regs_r16(0b00110000, 4)
+	uint8_t *p = cpu->bus->wr[adr >> 8];
+
+	if (p != NULL)
+		p[adr & 0xff] = data;
+	else
+		cpu->bus->write[adr >> 8](cpu, adr, data);
 
-	reg--;
+	if (cpu->writes != NULL && cpu->writes->n < WRITES_MAX)
+		cpu->writes->adr[cpu->writes->n++] = adr;
+}
 
-	set_r8_from_r16()
+/*
+ * window (0 for 0000-3fff, 1 for 4000-7fff) now has bank mapped. its code
+ * tables become the ones of that bank in that window, whatever was decoded
+ * from it before is still good as the rom can't be written
+ */
+void
+cpu_rom_mapped(struct CPU *cpu, int window, int bank)
+{
+	/* nothing is decoded without an icache, the lockstep reference */
+	if (cpu->icache == NULL)
+		return;
 
-	return 2;
+	struct BankCode **bc = &cpu->bank_code[window * ROM_BANKS_MAX + bank];
+	if (*bc == NULL && (*bc = calloc(1, sizeof(struct BankCode))) == NULL) {
+		fprintf(stderr, "out of memory for the code of rom bank %d\n", bank);
+		exit(1);
+	}
+
+	/* a block running from the window was decoded from the old bank */
+	if (cpu->rom_code[window] != *bc && cpu->engine != ENGINE_INTERP
+			&& cpu->pc < 0x8000 && cpu->pc >> 14 == window)
+		cpu->smc |= SMC_REMAPPED;
+	cpu->rom_code[window] = *bc;
 }
 
-static int
-add_hl_r16(struct CPU *cpu, uint8_t opcode)
+/* [adr, adr + len) was written around write8 */
+void
+cpu_invalidate(struct CPU *cpu, uint16_t adr, int len)
 {
-	set_regs_r16(0b00110000, 4);
-	(void)high;
-	(void)low;
+	for (int i = 0; i < len; i++)
+		invalidate(cpu, adr + i);
+}
 
-	uint16_t hl = cpu->h << 8 | cpu->l;
-	/* TODO: do without uint32_t? */
-	uint32_t res = hl + reg;
+static uint8_t
+get_r8(struct CPU *cpu, uint8_t off)
+{
+	if (off == R8_HL)
+		return read8(cpu, cpu->hl);
+	return *((uint8_t *)cpu + off);
+}
 
-	cpu->f.n = 0;
+static void
+set_r8(struct CPU *cpu, uint8_t off, uint8_t n)
+{
+	if (off == R8_HL)
+		write8(cpu, cpu->hl, n);
+	else
+		*((uint8_t *)cpu + off) = n;
+}
+
+static uint8_t
+get_c(const struct CPU *cpu)
+{
+	const struct Lazy *lz = &cpu->lazy;
+
+	switch (lz->op) {
+		case LAZY_NONE:
+			return cpu->f.c;
+		case LAZY_ADD:
+			return lz->x + lz->y + lz->c > 0xff;
+		case LAZY_SUB:
+			return lz->y + lz->c > lz->x;
+		case LAZY_AND:
+		case LAZY_OR:
+			return 0;
+		default: /* inc, dec */
+			return lz->c;
+	}
+}
 
-	cpu->f.h = (((hl & 0xfff) + (reg & 0xfff)) & 0x1000) == 0x1000;
-	cpu->f.c = res > 0xffff;
+static uint8_t
+get_z(const struct CPU *cpu)
+{
+	if (cpu->lazy.op == LAZY_NONE)
+		return cpu->f.z;
+	return cpu->lazy.res == 0;
+}
+
+static void
+materialize(struct CPU *cpu)
+{
+	const struct Lazy *lz = &cpu->lazy;
+
+	switch (lz->op) {
+		case LAZY_ADD:
+			cpu->f.flags = alu_add_flags(lz->x, lz->y, lz->c);
+			break;
+		case LAZY_SUB:
+			cpu->f.flags = alu_sub_flags(lz->x, lz->y, lz->c);
+			break;
+		case LAZY_AND:
+			cpu->f.flags = alu_add[lz->res] | FLAG_H;
+			break;
+		case LAZY_OR:
+			cpu->f.flags = alu_add[lz->res];
+			break;
+		case LAZY_INC:
+			cpu->f.flags = alu_inc[lz->res] | lz->c << 4;
+			break;
+		case LAZY_DEC:
+			cpu->f.flags = alu_dec[lz->res] | lz->c << 4;
+			break;
+	}
+
+	cpu->lazy.op = LAZY_NONE;
+}
 
-	cpu->h = res >> 8;
-	cpu->l = res & 0xff;
+/* brings f up to date, anything reading or partly writing f calls this first */
+void
+cpu_sync_flags(struct CPU *cpu)
+{
+	if (cpu->lazy.op != LAZY_NONE)
+		materialize(cpu);
+}
 
-	return 2;
+static void
+sync(struct CPU *cpu)
+{
+#ifdef LAZY_FLAGS
+	cpu_sync_flags(cpu);
+#else
+	(void)cpu;
+#endif
 }
 
+/* with LAZY_FLAGS only the operands are kept until the flags are needed */
+static void
+set_flags(struct CPU *cpu, uint8_t op, uint8_t x, uint8_t y, uint8_t c, uint8_t res)
+{
+	cpu->lazy = (struct Lazy){ .op = op, .x = x, .y = y, .res = res, .c = c };
+#ifndef LAZY_FLAGS
+	materialize(cpu);
+#endif
+}
 
 static int
-dec_r8(struct CPU *cpu, uint8_t opcode)
+cond(struct CPU *cpu, uint8_t opcode)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 3);
+	switch (opcode >> 3 & 0b11) {
+		case nzero:
+			return get_z(cpu) == 0;
+		case zero:
+			return get_z(cpu);
+		case ncarry:
+			return get_c(cpu) == 0;
+		case carry:
+			return get_c(cpu);
+		default: /* should be unreachable */
+			assert(NULL);
+			return 0;
+	}
+}
 
-	(*reg)--;
 
-	set_zn(cpu, *reg, 1);
-	cpu->f.h = (*reg & 0b1111) == 0b1111;
+static void
+set_hc(struct CPU *cpu, uint8_t a, uint8_t b)
+{
+	cpu->f.h = (((a & 0xF) + (b & 0xF)) & 0x10) == 0x10;
+	cpu->f.c = (((a & 0xFF) + (b & 0xFF)) & 0x100) == 0x100;
+}
 
-	if (((opcode & 0b00111000) >> 3) == m)
-		return 3;
-	return 1;
+static uint16_t
+pop(struct CPU *cpu)
+{
+	cpu->sp += 2;
+	return read8(cpu, cpu->sp - 1) << 8 | read8(cpu, cpu->sp - 2);
 }
 
-static int
-inc_r8(struct CPU *cpu, uint8_t opcode)
+static void
+push(struct CPU *cpu, uint16_t n)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 3);
+	write8(cpu, --cpu->sp, n >> 8);
+	write8(cpu, --cpu->sp, n & 0xff);
+}
 
-	(*reg)++;
 
-	set_zn(cpu, *reg, 0);
-	/* TODO: possible bug? */
-	cpu->f.h = (*reg & 0b1111) == 0b0000;
+static void
+add(struct CPU *cpu, uint8_t n)
+{
+	uint8_t a = cpu->a;
 
-	if (((opcode & 0b00111000) >> 3) == m)
-		return 3;
-	return 1;
+	cpu->a += n;
+	set_flags(cpu, LAZY_ADD, a, n, 0, cpu->a);
 }
 
-static int
-ld_r16_imm16(struct CPU *cpu, uint8_t opcode)
+static void
+adc(struct CPU *cpu, uint8_t n)
 {
+	uint8_t a = cpu->a;
+	uint8_t c = get_c(cpu);
 
-	set_regs_r16(0b00110000, 4)
+	cpu->a = a + n + c;
+	set_flags(cpu, LAZY_ADD, a, n, c, cpu->a);
+}
 
-	reg = mem_read(cpu->memory, cpu->pc + 1) << 8 | mem_read(cpu->memory, cpu->pc);
+static void
+sub(struct CPU *cpu, uint8_t n)
+{
+	uint8_t a = cpu->a;
 
-	set_r8_from_r16()
-	cpu->pc += 2;
+	cpu->a -= n;
+	set_flags(cpu, LAZY_SUB, a, n, 0, cpu->a);
+}
 
-	return 3;
+static void
+sbc(struct CPU *cpu, uint8_t n)
+{
+	uint8_t a = cpu->a;
+	uint8_t c = get_c(cpu);
+
+	cpu->a = a - n - c;
+	set_flags(cpu, LAZY_SUB, a, n, c, cpu->a);
 }
 
-static int
-ld_r16mem_a(struct CPU *cpu, uint8_t opcode)
+static void
+and(struct CPU *cpu, uint8_t n)
 {
-	set_regs_r16mem(0b00110000, 4);
-	(void)high;
-	(void)low;
+	cpu->a &= n;
+	set_flags(cpu, LAZY_AND, 0, 0, 0, cpu->a);
+}
 
-	mem_write(cpu->memory, reg, cpu->a);
+static void
+xor(struct CPU *cpu, uint8_t n)
+{
+	cpu->a ^= n;
+	set_flags(cpu, LAZY_OR, 0, 0, 0, cpu->a);
+}
 
-	if (op == hli)
-		inc_r16(cpu, hl << 4);
-	if (op == hld)
-		dec_r16(cpu, hl << 4);
+static void
+or(struct CPU *cpu, uint8_t n)
+{
+	cpu->a |= n;
+	set_flags(cpu, LAZY_OR, 0, 0, 0, cpu->a);
+}
 
-	return 2;
+static void
+cp(struct CPU *cpu, uint8_t n)
+{
+	set_flags(cpu, LAZY_SUB, cpu->a, n, 0, cpu->a - n);
 }
 
-static int
-ld_a_r16mem(struct CPU *cpu, uint8_t opcode)
+static void
+jp(struct CPU *cpu, uint16_t adr)
 {
-	set_regs_r16mem(0b00110000, 4);
-	(void)high;
-	(void)low;
+	cpu->pc = adr;
+}
 
-	cpu->a = mem_read(cpu->memory, reg);
+static void
+call(struct CPU *cpu, uint16_t adr)
+{
+	push(cpu, cpu->pc);
 
-	if (op == hli)
-		inc_r16(cpu, hl << 4);
-	if (op == hld)
-		dec_r16(cpu, hl << 4);
-	return 2;
+	cpu->pc = adr;
 }
 
 static int
-ld_imm16_sp(struct CPU *cpu)
+inc_r16(struct CPU *cpu, const struct Instr *in)
 {
-	uint16_t adr = mem_read(cpu->memory, cpu->pc + 1) << 8 | mem_read(cpu->memory, cpu->pc);
+	(*r16(cpu, r16off, in->opcode))++;
+	return in->cycles;
+}
 
-	mem_write(cpu->memory, adr, cpu->sp & 0xff);
-	mem_write(cpu->memory, adr + 1, cpu->sp >> 8);
-	cpu->pc += 2;
-	return 5;
+static int
+dec_r16(struct CPU *cpu, const struct Instr *in)
+{
+	(*r16(cpu, r16off, in->opcode))--;
+	return in->cycles;
 }
 
 static int
-ld_r8_r8(struct CPU *cpu, uint8_t opcode)
+add_hl_r16(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *dst = parse_r8(cpu, opcode, 3);
-	uint8_t *src = parse_r8(cpu, opcode, 0);
+	sync(cpu);
+	uint16_t reg = *r16(cpu, r16off, in->opcode);
+	uint32_t res = cpu->hl + reg;
 
-	*dst = *src;
+	cpu->f.n = 0;
+	cpu->f.h = (((cpu->hl & 0xfff) + (reg & 0xfff)) & 0x1000) == 0x1000;
+	cpu->f.c = res > 0xffff;
+	cpu->hl = res;
 
-	if ((opcode & 0b00111000) >> 3 == m)
-		return 2;
-	if ((opcode & 0b00000111) == m)
-		return 2;
-	return 1;
+	return in->cycles;
 }
 
+
 static int
-ld_r8_imm8(struct CPU *cpu, uint8_t opcode)
+dec_r8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *dst = parse_r8(cpu, opcode, 3);
+	uint8_t reg = get_r8(cpu, in->dst) - 1;
 
-	*dst = mem_read(cpu->memory, cpu->pc);
+	set_r8(cpu, in->dst, reg);
+	set_flags(cpu, LAZY_DEC, 0, 0, get_c(cpu), reg);
 
-	cpu->pc += 1;
+	return in->cycles;
+}
 
-	if ((opcode & 0b00111000) >> 3 == m)
-		return 3;
+static int
+inc_r8(struct CPU *cpu, const struct Instr *in)
+{
+	uint8_t reg = get_r8(cpu, in->dst) + 1;
+
+	set_r8(cpu, in->dst, reg);
+	set_flags(cpu, LAZY_INC, 0, 0, get_c(cpu), reg);
 
-	return 2;
+	return in->cycles;
 }
 
-static void
-rlca(struct CPU *cpu)
+static int
+ld_r16_imm16(struct CPU *cpu, const struct Instr *in)
 {
-	cpu->f.c = cpu->a >> 7;
-	cpu->a <<= 1;
-	cpu->a |= cpu->f.c;
-
-	cpu->f.z = 0;
-	cpu->f.n = 0;
-	cpu->f.h = 0;
+	*r16(cpu, r16off, in->opcode) = in->imm;
+	return in->cycles;
 }
 
 static void
-rrca(struct CPU *cpu)
+step_hl(struct CPU *cpu, int op)
 {
-	cpu->f.c = cpu->a & 0x01;
-	cpu->a >>= 1;
-	cpu->a |= cpu->f.c << 7;
+	if (op == hli)
+		cpu->hl++;
+	if (op == hld)
+		cpu->hl--;
+}
 
-	cpu->f.z = 0;
-	cpu->f.n = 0;
-	cpu->f.h = 0;
+static int
+ld_r16mem_a(struct CPU *cpu, const struct Instr *in)
+{
+	write8(cpu, *r16(cpu, r16memoff, in->opcode), cpu->a);
+	step_hl(cpu, in->opcode >> 4 & 0b11);
+
+	return in->cycles;
 }
 
-static void
-rla(struct CPU *cpu)
+static int
+ld_a_r16mem(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t tmp = cpu->a;
-	cpu->a <<= 1;
-	cpu->a |= cpu->f.c;
-	cpu->f.c = tmp >> 7;
+	cpu->a = read8(cpu, *r16(cpu, r16memoff, in->opcode));
+	step_hl(cpu, in->opcode >> 4 & 0b11);
 
-	cpu->f.z = 0;
-	cpu->f.n = 0;
-	cpu->f.h = 0;
+	return in->cycles;
 }
 
-static void
-rra(struct CPU *cpu)
+static int
+ld_imm16_sp(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t tmp = cpu->a;
-	cpu->a >>= 1;
-	cpu->a |= cpu->f.c << 7;
-	cpu->f.c = tmp & 0x01;
+	write8(cpu, in->imm, cpu->sp & 0xff);
+	write8(cpu, in->imm + 1, cpu->sp >> 8);
+	return in->cycles;
+}
 
-	cpu->f.z = 0;
-	cpu->f.n = 0;
-	cpu->f.h = 0;
+static int
+ld_r8_r8(struct CPU *cpu, const struct Instr *in)
+{
+	set_r8(cpu, in->dst, get_r8(cpu, in->src));
+	return in->cycles;
 }
 
-/* TODO: might be broken, manually test later */
-static void
-daa(struct CPU *cpu)
+static int
+ld_r8_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t adj = 0;
+	set_r8(cpu, in->dst, in->imm);
+	return in->cycles;
+}
 
-	if (cpu->f.h || (!cpu->f.n && (cpu->a & 0x0F) > 0x09)) {
-		adj |= 0x06;
-	}
+/*
+ * rlca, rrca, rla, rra and the cb rotates, shifts and swap, the row of the
+ * opcode picks the op. the one byte forms clear z
+ */
+static int
+shift(struct CPU *cpu, const struct Instr *in)
+{
+	uint8_t mask = in->len == 1 ? (uint8_t)~FLAG_Z : 0xff;
+	uint16_t r = alu_shift[in->opcode >> 3][get_c(cpu)][get_r8(cpu, in->src)];
 
-	if (cpu->f.c || (!cpu->f.n && cpu->a > 0x99)) {
-		adj |= 0x60;
-		cpu->f.c = 1;
-	}
+	set_r8(cpu, in->src, r & 0xff);
+	cpu->lazy.op = LAZY_NONE;
+	cpu->f.flags = (r >> 8) & mask;
 
-	cpu->a += adj * (cpu->f.n ? -1 : 1);
+	return in->cycles;
+}
 
-	cpu->f.z = (cpu->a == 0);
-	cpu->f.h = 0;
+static int
+daa(struct CPU *cpu, const struct Instr *in)
+{
+	sync(cpu);
+
+	uint16_t r = alu_daa[(cpu->f.flags >> 4 & 0b111) << 8 | cpu->a];
+	cpu->a = r & 0xff;
+	cpu->f.flags = r >> 8;
+
+	return in->cycles;
 }
 
-static void
-cpl(struct CPU *cpu)
+static int
+cpl(struct CPU *cpu, const struct Instr *in)
 {
+	sync(cpu);
 	cpu->a = ~cpu->a;
 	cpu->f.n = 1;
 	cpu->f.h = 1;
+
+	return in->cycles;
 }
 
-static void
-scf(struct CPU *cpu)
+static int
+scf(struct CPU *cpu, const struct Instr *in)
 {
+	sync(cpu);
 	cpu->f.c = 1;
 	cpu->f.n = 0;
 	cpu->f.h = 0;
+
+	return in->cycles;
 }
 
-static void
-ccf(struct CPU *cpu)
+static int
+ccf(struct CPU *cpu, const struct Instr *in)
 {
+	sync(cpu);
 	cpu->f.c = ~cpu->f.c;
 	cpu->f.n = 0;
 	cpu->f.h = 0;
+
+	return in->cycles;
 }
 
 static int
-bit_shift(struct CPU *cpu, uint8_t opcode)
+jr_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	switch (opcode >> 3) {
-		case 0:
-			rlca(cpu);
-			break;
-		case 1:
-			rrca(cpu);
-			break;
-		case 2:
-			rla(cpu);
-			break;
-		case 3:
-			rra(cpu);
-			break;
-		case 4:
-			daa(cpu);
-			break;
-		case 5:
-			cpl(cpu);
-			break;
-		case 6:
-			scf(cpu);
-			break;
-		case 7:
-			ccf(cpu);
-			break;
-		default:
-			unimlemented_opcode(opcode);
-			break;
-	}
-	return 1;
+	cpu->pc += (int8_t)in->imm;
+	return in->cycles;
 }
 
 static int
-jr_imm8(struct CPU *cpu, uint8_t opcode)
+jr_cond(struct CPU *cpu, const struct Instr *in)
 {
-	/* jr e8 */
-	if (opcode == 0x18)
-		goto jmp;
+	if (!cond(cpu, in->opcode))
+		return in->cycles;
 
-	/* other */
-	switch (opcode >> 3 & 0b11) {
-		case nzero:
-			if (cpu->f.z == 0)
-				goto jmp;
-			break;
-		case zero:
-			if (cpu->f.z)
-				goto jmp;
-			break;
-		case ncarry:
-			if (cpu->f.c == 0)
-				goto jmp;
-			break;
-		case carry:
-			if (cpu->f.c)
-				goto jmp;
-			break;
-		default:
-			fprintf(stderr, "incorrect jmp\n");
-			exit(1);
-		break;
-	}
-
-	cpu->pc++;
-	return 2;
-
-jmp:
-	cpu->pc += (int8_t)mem_read(cpu->memory, cpu->pc) + 1;
-	return 3;
+	cpu->pc += (int8_t)in->imm;
+	return in->cycles + 1;
 }
 
 /* MASSIVE TODO: implement more complex stop based on outside hardware */
 static int
-stop(struct CPU *cpu)
+stop(struct CPU *cpu, const struct Instr *in)
 {
 	cpu->stop = 1;
-	return 1;
+	return in->cycles;
 }
 
 /* TODO: implement 1 cycle delay later */
 static int
-ei(struct CPU *cpu)
+ei(struct CPU *cpu, const struct Instr *in)
 {
 	cpu->ime = IME_NEXT;
-	return 1;
+	return in->cycles;
 }
 
 static int
-di(struct CPU *cpu)
+di(struct CPU *cpu, const struct Instr *in)
 {
 	cpu->ime = IME_UNSET;
-	return 1;
-}
-
-static int
-halt(struct CPU *cpu)
-{
-	cpu->halt = 1;
-	return 1;
-}
-
-
-/* TODO? fix h flag */
-static int
-add_r8(struct CPU *cpu, uint8_t opcode)
-{
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	add(cpu, *reg);
-
-	if ((opcode & 0b111) == m)
-		return 2;
-
-	return 1;
-}
-
-static int
-adc_r8(struct CPU *cpu, uint8_t opcode)
-{
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	adc(cpu, *reg);
-
-	if ((opcode & 0b111) == m)
-		return 2;
-
-	return 1;
+	return in->cycles;
 }
 
 static int
-sub_r8(struct CPU *cpu, uint8_t opcode)
+halt(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	sub(cpu, *reg);
+	/* with ime off and an interrupt already pending the cpu never halts */
+	if (cpu->ime == IME_UNSET && interrupt_pending(cpu->memory))
+		cpu->halt_bug = 1;
+	else
+		cpu->halt = 1;
+	return in->cycles;
+}
 
-	if ((opcode & 0b111) == m)
-		return 2;
 
-	return 1;
+/* TODO? fix h flag */
+static int
+add_r8(struct CPU *cpu, const struct Instr *in)
+{
+	add(cpu, get_r8(cpu, in->src));
+	return in->cycles;
 }
 
 static int
-sbc_r8(struct CPU *cpu, uint8_t opcode)
+adc_r8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	sbc(cpu, *reg);
-
-	if ((opcode & 0b111) == m)
-		return 2;
-
-	return 1;
+	adc(cpu, get_r8(cpu, in->src));
+	return in->cycles;
 }
 
 static int
-and_r8(struct CPU *cpu, uint8_t opcode)
+sub_r8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	and(cpu, *reg);
-
-	if ((opcode & 0b111) == m)
-		return 2;
-
-	return 1;
+	sub(cpu, get_r8(cpu, in->src));
+	return in->cycles;
 }
 
 static int
-xor_r8(struct CPU *cpu, uint8_t opcode)
+sbc_r8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	xor(cpu, *reg);
-
-	if ((opcode & 0b111) == m)
-		return 2;
-
-	return 1;
+	sbc(cpu, get_r8(cpu, in->src));
+	return in->cycles;
 }
 
 static int
-or_r8(struct CPU *cpu, uint8_t opcode)
+and_r8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	or(cpu, *reg);
-
-	if ((opcode & 0b111) == m)
-		return 2;
-
-	return 1;
+	and(cpu, get_r8(cpu, in->src));
+	return in->cycles;
 }
 
 static int
-cp_r8(struct CPU *cpu, uint8_t opcode)
+xor_r8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	cp(cpu, *reg);
+	xor(cpu, get_r8(cpu, in->src));
+	return in->cycles;
+}
 
-	if ((opcode & 0b111) == m)
-		return 2;
+static int
+or_r8(struct CPU *cpu, const struct Instr *in)
+{
+	or(cpu, get_r8(cpu, in->src));
+	return in->cycles;
+}
 
-	return 1;
+static int
+cp_r8(struct CPU *cpu, const struct Instr *in)
+{
+	cp(cpu, get_r8(cpu, in->src));
+	return in->cycles;
 }
 
 /* TODO? fix h flag */
 static int
-add_imm8(struct CPU *cpu, uint8_t n)
+add_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	add(cpu, n);
-
-	cpu->pc++;
-	return 2;
+	add(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-adc_imm8(struct CPU *cpu, uint8_t n)
+adc_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	adc(cpu, n);
-
-	cpu->pc++;
-	return 2;
+	adc(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-sub_imm8(struct CPU *cpu, uint8_t n)
+sub_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	sub(cpu, n);
-
-	cpu->pc++;
-	return 2;
+	sub(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-sbc_imm8(struct CPU *cpu, uint8_t n)
+sbc_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	sbc(cpu, n);
-
-	cpu->pc++;
-	return 2;
+	sbc(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-and_imm8(struct CPU *cpu, uint8_t n)
+and_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	and(cpu, n);
-	cpu->pc++;
-	return 2;
+	and(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-xor_imm8(struct CPU *cpu, uint8_t n)
+xor_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	xor(cpu, n);
-	cpu->pc++;
-	return 2;
+	xor(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-or_imm8(struct CPU *cpu, uint8_t n)
+or_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	or(cpu, n);
-	cpu->pc++;
-	return 2;
+	or(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-cp_imm8(struct CPU *cpu, uint8_t n)
+cp_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	cp(cpu, n);
-	cpu->pc++;
-	return 2;
+	cp(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-ret(struct CPU *cpu)
+ret(struct CPU *cpu, const struct Instr *in)
 {
-	cpu->pc = pop(cpu, NULL, NULL);
-	return 4;
+	cpu->pc = pop(cpu);
+	return in->cycles;
 }
 
 static int
-reti(struct CPU *cpu)
+reti(struct CPU *cpu, const struct Instr *in)
 {
-	ret(cpu);
+	cpu->pc = pop(cpu);
 	cpu->ime = 1;
-	return 4;
+	return in->cycles;
 }
 
 static int
-ret_cond(struct CPU *cpu, uint8_t opcode)
+ret_cond(struct CPU *cpu, const struct Instr *in)
 {
-	switch (opcode >> 3 & 0b11) {
-		case nzero:
-			if (cpu->f.z == 0) goto ret;
-			break;
-		case zero:
-			if (cpu->f.z == 1) goto ret;
-			break;
-		case ncarry:
-			if (cpu->f.c == 0) goto ret;
-			break;
-		case carry:
-			if (cpu->f.c == 1) goto ret;
-			break;
-		default:
-			break;
-	}
-
-	return 2;
+	if (!cond(cpu, in->opcode))
+		return in->cycles;
 
-ret:
-	ret(cpu);
-	return 5;
+	cpu->pc = pop(cpu);
+	return in->cycles + 3;
 }
 
 static int
-jp_a16(struct CPU *cpu)
+jp_a16(struct CPU *cpu, const struct Instr *in)
 {
-	jp(cpu, mem_read(cpu->memory, cpu->pc + 1), mem_read(cpu->memory, cpu->pc));
-	return 4;
+	jp(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-jp_hl(struct CPU *cpu)
+jp_hl(struct CPU *cpu, const struct Instr *in)
 {
-	jp(cpu, cpu->h, cpu->l);
-	return 1;
+	jp(cpu, cpu->hl);
+	return in->cycles;
 }
 
 static int
-jp_cond(struct CPU *cpu, uint8_t opcode)
+jp_cond(struct CPU *cpu, const struct Instr *in)
 {
-	switch (opcode >> 3 & 0b11) {
-		case nzero:
-			if (cpu->f.z == 0)
-				goto jmp;
-			break;
-		case zero:
-			if (cpu->f.z)
-				goto jmp;
-			break;
-		case ncarry:
-			if (cpu->f.c == 0)
-				goto jmp;
-			break;
-		case carry:
-			if (cpu->f.c)
-				goto jmp;
-			break;
-		default:
-			fprintf(stderr, "incorrect jmp\n");
-			exit(1);
-		break;
-	}
-
-	cpu->pc += 2;
-	return 3;
+	if (!cond(cpu, in->opcode))
+		return in->cycles;
 
-jmp:
-	jp(cpu, mem_read(cpu->memory, cpu->pc + 1), mem_read(cpu->memory, cpu->pc));
-	return 4;
+	jp(cpu, in->imm);
+	return in->cycles + 1;
 }
 
 static int
-call_a16(struct CPU *cpu)
+call_a16(struct CPU *cpu, const struct Instr *in)
 {
-	call(cpu, mem_read(cpu->memory, cpu->pc + 1), mem_read(cpu->memory, cpu->pc));
-	return 6;
+	call(cpu, in->imm);
+	return in->cycles;
 }
 
 static int
-call_cond(struct CPU *cpu, uint8_t opcode)
+call_cond(struct CPU *cpu, const struct Instr *in)
 {
-	switch (opcode >> 3 & 0b11) {
-		case nzero:
-			if (cpu->f.z == 0)
-				goto call;
-			break;
-		case zero:
-			if (cpu->f.z)
-				goto call;
-			break;
-		case ncarry:
-			if (cpu->f.c == 0)
-				goto call;
-			break;
-		case carry:
-			if (cpu->f.c)
-				goto call;
-			break;
-		default:
-			fprintf(stderr, "incorrect call\n");
-			exit(1);
-		break;
-	}
+	if (!cond(cpu, in->opcode))
+		return in->cycles;
 
-	cpu->pc += 2;
-	return 3;
-
-call:
-	call(cpu, mem_read(cpu->memory, cpu->pc + 1), mem_read(cpu->memory, cpu->pc));
-	return 6;
+	call(cpu, in->imm);
+	return in->cycles + 3;
 }
 
 static int
-rst(struct CPU *cpu, uint8_t opcode)
+rst(struct CPU *cpu, const struct Instr *in)
 {
-	uint16_t adr = (opcode >> 3 & 0b111) * 8;
-	push(cpu, cpu->pc >> 8, cpu->pc & 0xff);
-
-	jp(cpu, adr >> 8, adr & 0xff);
-	return 4;
+	call(cpu, in->opcode & 0b00111000);
+	return in->cycles;
 }
 
 static int
-ld_sp_hl(struct CPU *cpu)
+ld_sp_hl(struct CPU *cpu, const struct Instr *in)
 {
-	cpu->sp = cpu->h << 8 | cpu->l;
-	return 2;
+	cpu->sp = cpu->hl;
+	return in->cycles;
 }
 
 static int
-pop_r16stk(struct CPU *cpu, uint8_t opcode)
+pop_r16stk(struct CPU *cpu, const struct Instr *in)
 {
-	set_regs_r16stk(0b00110000, 4);
-	(void)reg;
+	sync(cpu);
+	uint16_t *reg = r16(cpu, r16stkoff, in->opcode);
 
-	pop(cpu, high, low);
+	*reg = pop(cpu);
+	if (reg == &cpu->af)
+		cpu->f.flags &= 0xf0;
 
-	if (op == s_af)
-		*low &= 0xf0;
-	return 3;
+	return in->cycles;
 }
 
 static int
-push_r16stk(struct CPU *cpu, uint8_t opcode)
+push_r16stk(struct CPU *cpu, const struct Instr *in)
 {
-	set_regs_r16stk(0b00110000, 4);
-	(void)reg;
-
-	mem_write(cpu->memory, --cpu->sp, *high);
-	mem_write(cpu->memory, --cpu->sp, *low);
+	sync(cpu);
+	push(cpu, *r16(cpu, r16stkoff, in->opcode));
 
-	return 4;
+	return in->cycles;
 }
 
 static int
-ldh(struct CPU *cpu, const uint8_t opcode)
-{
-	switch (opcode) {
-		case 0xE0:
-			mem_write(cpu->memory, 0xFF00 + mem_read(cpu->memory, cpu->pc++), cpu->a);
-			return 3;
-		break;
-		case 0xE2:
-			mem_write(cpu->memory, 0xFF00 + cpu->c, cpu->a);
-			return 2;
-		break;
-		case 0xEA:
-			mem_write(cpu->memory, mem_read(cpu->memory, cpu->pc) | mem_read(cpu->memory, cpu->pc + 1) << 8, cpu->a);
-			cpu->pc += 2;
-			return 4;
-		break;
-		case 0xf0:
-			cpu->a = mem_read(cpu->memory, 0xFF00 + mem_read(cpu->memory, cpu->pc++));
-			return 3;
-		break;
-		case 0xf2:
-			cpu->a = mem_read(cpu->memory, 0xFF00 + cpu->c);
-			return 2;
-		break;
-		case 0xf8: {
-			uint8_t e = mem_read(cpu->memory, cpu->pc++);
-
-			cpu->f.z = 0;
-			cpu->f.n = 0;
-
-			set_hc(cpu, e, cpu->sp);
-
-			cpu->h = ((cpu->sp + (int8_t)e) & 0xFF00) >> 8;
-			cpu->l = (cpu->sp + (int8_t)e) & 0xFF;
-			return 3;
-			break;
-		}
-		case 0xfa:
-			cpu->a = mem_read(cpu->memory, mem_read(cpu->memory, cpu->pc) | mem_read(cpu->memory, cpu->pc + 1) << 8);
-			cpu->pc += 2;
-			return 4;
-		break;
-		default:
-			unimlemented_opcode(opcode);
-		break;
-	}
-
-	return 3;
+ldh_imm8_a(struct CPU *cpu, const struct Instr *in)
+{
+	write8(cpu, 0xFF00 + (in->imm & 0xff), cpu->a);
+	return in->cycles;
 }
 
 static int
-add_sp_imm8(struct CPU *cpu)
+ldh_c_a(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t e = mem_read(cpu->memory, cpu->pc++);
-
-	cpu->f.z = 0;
-	cpu->f.n = 0;
-
-	set_hc(cpu, e, cpu->sp);
-
-	cpu->sp += (int8_t)e;
-
-	return 4;
+	write8(cpu, 0xFF00 + cpu->c, cpu->a);
+	return in->cycles;
 }
 
 static int
-rlc_r8(struct CPU *cpu, uint8_t opcode)
+ld_imm16_a(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-
-	cpu->f.c = *reg >> 7;
-	*reg <<= 1;
-	*reg |= cpu->f.c;
-
-	cpu->f.z = *reg == 0;
-
-	cpu->f.n = 0;
-	cpu->f.h = 0;
-
-	/* [hl] */
-	if (opcode == 0x06)
-		return 4;
-
-	return 2;
+	write8(cpu, in->imm, cpu->a);
+	return in->cycles;
 }
 
 static int
-rrc_r8(struct CPU *cpu, uint8_t opcode)
+ldh_a_imm8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
+	cpu->a = read8(cpu, 0xFF00 + (in->imm & 0xff));
+	return in->cycles;
+}
 
-	cpu->f.c = *reg & 1;
-	*reg >>= 1;
-	*reg |= cpu->f.c << 7;
+static int
+ldh_a_c(struct CPU *cpu, const struct Instr *in)
+{
+	cpu->a = read8(cpu, 0xFF00 + cpu->c);
+	return in->cycles;
+}
 
-	cpu->f.z = *reg == 0;
+static int
+ld_hl_sp_imm8(struct CPU *cpu, const struct Instr *in)
+{
+	sync(cpu);
+	uint8_t e = in->imm;
 
+	cpu->f.z = 0;
 	cpu->f.n = 0;
-	cpu->f.h = 0;
 
-	/* [hl] */
-	if (opcode == 0x0e)
-		return 4;
+	set_hc(cpu, e, cpu->sp);
 
-	return 2;
+	cpu->hl = cpu->sp + (int8_t)e;
+	return in->cycles;
 }
 
 static int
-rl_r8(struct CPU *cpu, uint8_t opcode)
+ld_a_imm16(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	uint8_t tmp = *reg >> 7;
-
-	*reg <<= 1;
-	*reg |= cpu->f.c;
-	cpu->f.c = tmp;
+	cpu->a = read8(cpu, in->imm);
+	return in->cycles;
+}
 
-	cpu->f.z = *reg == 0;
+static int
+add_sp_imm8(struct CPU *cpu, const struct Instr *in)
+{
+	sync(cpu);
+	uint8_t e = in->imm;
 
+	cpu->f.z = 0;
 	cpu->f.n = 0;
-	cpu->f.h = 0;
 
-	/* [hl] */
-	if (opcode == 0x16)
-		return 4;
+	set_hc(cpu, e, cpu->sp);
+
+	cpu->sp += (int8_t)e;
 
-	return 2;
+	return in->cycles;
 }
 
 static int
-rr_r8(struct CPU *cpu, uint8_t opcode)
+bit_b3_r8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	uint8_t tmp = *reg & 1;
-
-	*reg >>= 1;
-	*reg |= cpu->f.c << 7;
-	cpu->f.c = tmp;
-
-	cpu->f.z = *reg == 0;
+	sync(cpu);
+	uint8_t bit = (in->opcode >> 3) & 0b111;
 
+	cpu->f.z = (get_r8(cpu, in->src) & (1 << bit)) == 0;
 	cpu->f.n = 0;
-	cpu->f.h = 0;
-
-	/* [hl] */
-	if (opcode == 0x1e)
-		return 4;
+	cpu->f.h = 1;
 
-	return 2;
+	return in->cycles;
 }
 
 static int
-sla_r8(struct CPU *cpu, uint8_t opcode)
+res_b3_r8(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
+	uint8_t bit = (in->opcode >> 3) & 0b111;
 
-	cpu->f.c = *reg >> 7;
-	*reg <<= 1;
+	set_r8(cpu, in->src, get_r8(cpu, in->src) & ~(1 << bit));
 
-	cpu->f.z = *reg == 0;
+	return in->cycles;
+}
 
-	cpu->f.n = 0;
-	cpu->f.h = 0;
+static int
+set_b3_r8(struct CPU *cpu, const struct Instr *in)
+{
+	uint8_t bit = (in->opcode >> 3) & 0b111;
 
-	/* [hl] */
-	if (opcode == 0x26)
-		return 4;
+	set_r8(cpu, in->src, get_r8(cpu, in->src) | 1 << bit);
 
-	return 2;
+	return in->cycles;
 }
 
 static int
-sra_r8(struct CPU *cpu, uint8_t opcode)
+nop(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
+	(void)cpu;
+	return in->cycles;
+}
 
-	cpu->f.c = *reg & 1;
-	*reg >>= 1;
-	*reg |= (*reg >> 6) << 7;
+static int
+illegal(struct CPU *cpu, const struct Instr *in)
+{
+	(void)cpu;
+	fprintf(stderr, "0x%02x illigal opcode\n", in->opcode);
+	exit(1);
+}
 
-	cpu->f.z = *reg == 0;
+/* 0xcb is resolved through cbtable by decode() */
+#ifdef FUSE
+static int
+fuse_copy(struct CPU *cpu, const struct Instr *in)
+{
+	cpu->a = read8(cpu, cpu->hl++);
+	write8(cpu, cpu->de, cpu->a);
 
-	cpu->f.n = 0;
-	cpu->f.h = 0;
+	/* the store rewrote or banked out this block, inc de has to be fetched again */
+	if (cpu->smc & (SMC_WRITTEN | SMC_REMAPPED)) {
+		cpu->pc--;
+		return in->cycles - 2;
+	}
 
-	/* [hl] */
-	if (opcode == 0x2e)
-		return 4;
+	cpu->de++;
+	cpu->fused[FUSE_COPY]++;
 
-	return 2;
+	return in->cycles;
 }
 
 static int
-swap_r8(struct CPU *cpu, uint8_t opcode)
+fuse_dec_jr(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
+	uint8_t reg = get_r8(cpu, in->dst) - 1;
 
-	/* TODO: XOR? */
-	uint8_t tmp = *reg & 0x0f;
-	*reg >>= 4;
-	*reg |= tmp << 4;
+	set_r8(cpu, in->dst, reg);
+	set_flags(cpu, LAZY_DEC, 0, 0, get_c(cpu), reg);
+	cpu->fused[FUSE_DEC_JR]++;
 
-	cpu->f.z = *reg == 0;
-	cpu->f.c = cpu->f.h = cpu->f.n = 0;
+	if (reg == 0)
+		return in->cycles;
 
-	/* [hl] */
-	if (opcode == 0x36)
-		return 4;
-
-	return 2;
+	cpu->pc += (int8_t)in->imm;
+	return in->cycles + 1;
 }
 
 static int
-srl_r8(struct CPU *cpu, uint8_t opcode)
+fuse_cp_jr(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
+	uint8_t n = in->imm & 0xff;
 
-	cpu->f.c = *reg & 1;
-	*reg >>= 1;
+	cp(cpu, n);
+	cpu->fused[FUSE_CP_JR]++;
 
-	cpu->f.z = *reg == 0;
+	if (cpu->a != n)
+		return in->cycles;
 
-	cpu->f.n = 0;
-	cpu->f.h = 0;
+	cpu->pc += (int8_t)(in->imm >> 8);
+	return in->cycles + 1;
+}
 
-	/* [hl] */
-	if (opcode == 0x3e)
-		return 4;
+static int
+fuse_ldh_and(struct CPU *cpu, const struct Instr *in)
+{
+	cpu->a = read8(cpu, 0xFF00 + (in->imm & 0xff));
+	and(cpu, in->imm >> 8);
+	cpu->fused[FUSE_LDH_AND]++;
+
+	return in->cycles;
+}
+#endif /* FUSE */
+
+static int (*const optable[256])(struct CPU *cpu, const struct Instr *in) = {
+	/* 0x00 */ nop, ld_r16_imm16, ld_r16mem_a, inc_r16, inc_r8, dec_r8, ld_r8_imm8, shift,
+	/* 0x08 */ ld_imm16_sp, add_hl_r16, ld_a_r16mem, dec_r16, inc_r8, dec_r8, ld_r8_imm8, shift,
+	/* 0x10 */ stop, ld_r16_imm16, ld_r16mem_a, inc_r16, inc_r8, dec_r8, ld_r8_imm8, shift,
+	/* 0x18 */ jr_imm8, add_hl_r16, ld_a_r16mem, dec_r16, inc_r8, dec_r8, ld_r8_imm8, shift,
+	/* 0x20 */ jr_cond, ld_r16_imm16, ld_r16mem_a, inc_r16, inc_r8, dec_r8, ld_r8_imm8, daa,
+	/* 0x28 */ jr_cond, add_hl_r16, ld_a_r16mem, dec_r16, inc_r8, dec_r8, ld_r8_imm8, cpl,
+	/* 0x30 */ jr_cond, ld_r16_imm16, ld_r16mem_a, inc_r16, inc_r8, dec_r8, ld_r8_imm8, scf,
+	/* 0x38 */ jr_cond, add_hl_r16, ld_a_r16mem, dec_r16, inc_r8, dec_r8, ld_r8_imm8, ccf,
+	/* 0x40 */ ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8,
+	/* 0x48 */ ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8,
+	/* 0x50 */ ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8,
+	/* 0x58 */ ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8,
+	/* 0x60 */ ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8,
+	/* 0x68 */ ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8,
+	/* 0x70 */ ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, halt, ld_r8_r8,
+	/* 0x78 */ ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8, ld_r8_r8,
+	/* 0x80 */ add_r8, add_r8, add_r8, add_r8, add_r8, add_r8, add_r8, add_r8,
+	/* 0x88 */ adc_r8, adc_r8, adc_r8, adc_r8, adc_r8, adc_r8, adc_r8, adc_r8,
+	/* 0x90 */ sub_r8, sub_r8, sub_r8, sub_r8, sub_r8, sub_r8, sub_r8, sub_r8,
+	/* 0x98 */ sbc_r8, sbc_r8, sbc_r8, sbc_r8, sbc_r8, sbc_r8, sbc_r8, sbc_r8,
+	/* 0xa0 */ and_r8, and_r8, and_r8, and_r8, and_r8, and_r8, and_r8, and_r8,
+	/* 0xa8 */ xor_r8, xor_r8, xor_r8, xor_r8, xor_r8, xor_r8, xor_r8, xor_r8,
+	/* 0xb0 */ or_r8, or_r8, or_r8, or_r8, or_r8, or_r8, or_r8, or_r8,
+	/* 0xb8 */ cp_r8, cp_r8, cp_r8, cp_r8, cp_r8, cp_r8, cp_r8, cp_r8,
+	/* 0xc0 */ ret_cond, pop_r16stk, jp_cond, jp_a16, call_cond, push_r16stk, add_imm8, rst,
+	/* 0xc8 */ ret_cond, ret, jp_cond, NULL, call_cond, call_a16, adc_imm8, rst,
+	/* 0xd0 */ ret_cond, pop_r16stk, jp_cond, illegal, call_cond, push_r16stk, sub_imm8, rst,
+	/* 0xd8 */ ret_cond, reti, jp_cond, illegal, call_cond, illegal, sbc_imm8, rst,
+	/* 0xe0 */ ldh_imm8_a, pop_r16stk, ldh_c_a, illegal, illegal, push_r16stk, and_imm8, rst,
+	/* 0xe8 */ add_sp_imm8, jp_hl, ld_imm16_a, illegal, illegal, illegal, xor_imm8, rst,
+	/* 0xf0 */ ldh_a_imm8, pop_r16stk, ldh_a_c, di, illegal, push_r16stk, or_imm8, rst,
+	/* 0xf8 */ ld_hl_sp_imm8, ld_sp_hl, ld_a_imm16, ei, illegal, illegal, cp_imm8, rst,
+};
+
+static int (*const cbtable[256])(struct CPU *cpu, const struct Instr *in) = {
+	/* 0x00 */ shift, shift, shift, shift, shift, shift, shift, shift,
+	/* 0x08 */ shift, shift, shift, shift, shift, shift, shift, shift,
+	/* 0x10 */ shift, shift, shift, shift, shift, shift, shift, shift,
+	/* 0x18 */ shift, shift, shift, shift, shift, shift, shift, shift,
+	/* 0x20 */ shift, shift, shift, shift, shift, shift, shift, shift,
+	/* 0x28 */ shift, shift, shift, shift, shift, shift, shift, shift,
+	/* 0x30 */ shift, shift, shift, shift, shift, shift, shift, shift,
+	/* 0x38 */ shift, shift, shift, shift, shift, shift, shift, shift,
+	/* 0x40 */ bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8,
+	/* 0x48 */ bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8,
+	/* 0x50 */ bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8,
+	/* 0x58 */ bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8,
+	/* 0x60 */ bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8,
+	/* 0x68 */ bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8,
+	/* 0x70 */ bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8,
+	/* 0x78 */ bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8, bit_b3_r8,
+	/* 0x80 */ res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8,
+	/* 0x88 */ res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8,
+	/* 0x90 */ res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8,
+	/* 0x98 */ res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8,
+	/* 0xa0 */ res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8,
+	/* 0xa8 */ res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8,
+	/* 0xb0 */ res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8,
+	/* 0xb8 */ res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8, res_b3_r8,
+	/* 0xc0 */ set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8,
+	/* 0xc8 */ set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8,
+	/* 0xd0 */ set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8,
+	/* 0xd8 */ set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8,
+	/* 0xe0 */ set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8,
+	/* 0xe8 */ set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8,
+	/* 0xf0 */ set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8,
+	/* 0xf8 */ set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8, set_b3_r8,
+};
+
+/* instruction length in bytes */
+static const uint8_t oplen[256] = {
+	/* 0x00 */ 1, 3, 1, 1, 1, 1, 2, 1, 3, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x10 */ 1, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x20 */ 2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x30 */ 2, 3, 1, 1, 1, 1, 2, 1, 2, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x40 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0x50 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0x60 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0x70 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0x80 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0x90 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0xa0 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0xb0 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+	/* 0xc0 */ 1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1,
+	/* 0xd0 */ 1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 1, 2, 1,
+	/* 0xe0 */ 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+	/* 0xf0 */ 2, 1, 1, 1, 1, 1, 2, 1, 2, 1, 3, 1, 1, 1, 2, 1,
+};
+
+/* base cost in m-cycles, conditional branches add to it when taken */
+static const uint8_t opcycles[256] = {
+	/* 0x00 */ 1, 3, 2, 2, 1, 1, 2, 1, 5, 2, 2, 2, 1, 1, 2, 1,
+	/* 0x10 */ 1, 3, 2, 2, 1, 1, 2, 1, 3, 2, 2, 2, 1, 1, 2, 1,
+	/* 0x20 */ 2, 3, 2, 2, 1, 1, 2, 1, 2, 2, 2, 2, 1, 1, 2, 1,
+	/* 0x30 */ 2, 3, 2, 2, 3, 3, 3, 1, 2, 2, 2, 2, 1, 1, 2, 1,
+	/* 0x40 */ 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x50 */ 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x60 */ 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x70 */ 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x80 */ 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+	/* 0x90 */ 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+	/* 0xa0 */ 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+	/* 0xb0 */ 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+	/* 0xc0 */ 2, 3, 3, 4, 3, 4, 2, 4, 2, 4, 3, 0, 3, 6, 2, 4,
+	/* 0xd0 */ 2, 3, 3, 0, 3, 4, 2, 4, 2, 4, 3, 0, 3, 0, 2, 4,
+	/* 0xe0 */ 3, 3, 2, 0, 0, 4, 2, 4, 4, 1, 4, 0, 0, 0, 2, 4,
+	/* 0xf0 */ 3, 3, 2, 1, 0, 4, 2, 4, 3, 2, 4, 1, 0, 0, 2, 4,
+};
+
+static uint8_t
+cbcycles(uint8_t cb)
+{
+	if ((cb & 0b111) != m)
+		return 2;
 
-	return 2;
+	/* bit b3, [hl] doesn't write back */
+	if (cb >> 6 == 1)
+		return 3;
+	return 4;
 }
 
-static int
-bit_b3_r8(struct CPU *cpu, uint8_t opcode)
+/* bytes[] is the fetch stream starting at the opcode */
+static void
+decode(struct Instr *in, const uint8_t *bytes)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
+	uint8_t opcode = bytes[0];
 
-	uint8_t bit = (opcode >> 3) & 0b111;
+	in->fn = optable[opcode];
+	in->opcode = opcode;
+	in->len = oplen[opcode];
+	in->cycles = opcycles[opcode];
+	in->dst = r8off[(opcode >> 3) & 0b111];
+	in->src = r8off[opcode & 0b111];
+	in->imm = bytes[1] | bytes[2] << 8;
 
-	cpu->f.z = (*reg & (1 << bit)) == 0;
-	cpu->f.n = 0;
-	cpu->f.h = 1;
+	if (opcode == 0xcb) {
+		uint8_t cb = bytes[1];
 
-	if ((opcode & 0b111) == m)
-		return 3;
+		in->fn = cbtable[cb];
+		in->opcode = cb;
+		in->cycles = cbcycles(cb);
+		in->src = r8off[cb & 0b111];
+	}
+}
 
-	return 2;
+/* rom, wram and hram are cached by pc, anything else is decoded every time */
+int
+cpu_cacheable(uint16_t adr)
+{
+	return adr < 0x8000 || (adr >= 0xC000 && adr < 0xE000) || adr >= 0xFF80;
 }
 
-static int
-res_b3_r8(struct CPU *cpu, uint8_t opcode)
+/*
+ * the instruction at pc has bytes in another window, which can be banked
+ * separately, so it is decoded every time
+ */
+int
+cpu_crosses(const struct CPU *cpu, uint16_t pc)
 {
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
+	return cpu_code_window(pc) != cpu_code_window(pc + oplen[cpu_peek(cpu, pc)] - 1);
+}
 
-	uint8_t bit = (opcode >> 3) & 0b111;
+void
+cpu_decode(struct CPU *cpu, uint16_t pc, struct Instr *in)
+{
+	uint8_t bytes[3] = {
+		cpu_peek(cpu, pc),
+		cpu_peek(cpu, pc + 1),
+		cpu_peek(cpu, pc + 2),
+	};
+	decode(in, bytes);
 
-	*reg &= ~(1 << bit);
+	if (cpu_cacheable(pc)) {
+		watch(cpu, pc);
+		watch(cpu, pc + in->len - 1);
+	}
+}
 
-	if ((opcode & 0b111) == m)
-		return 4;
+/*
+ * replaces the run of instructions at pc with one superinstruction if it is
+ * a known idiom of at most max instructions. returns how many it covers
+ */
+int
+cpu_fuse(struct CPU *cpu, uint16_t pc, struct Instr *in, int max)
+{
+#ifdef FUSE
+	uint8_t b[4];
+	struct Instr fused = { 0 };
+	int n = 2;
+
+	for (int i = 0; i < 4; i++)
+		b[i] = cpu_peek(cpu, pc + i);
+
+	if (b[0] == 0x2a && b[1] == 0x12 && b[2] == 0x13) {
+		fused = (struct Instr){ .fn = fuse_copy, .opcode = FUSE_COPY, .len = 3 };
+		n = 3;
+	} else if ((b[0] & 0xc7) == 0x05 && b[0] != 0x35 && b[1] == 0x20) {
+		fused = (struct Instr){ .fn = fuse_dec_jr, .opcode = FUSE_DEC_JR, .len = 3,
+			.dst = r8off[b[0] >> 3 & 0b111], .imm = b[2] };
+	} else if (b[0] == 0xfe && b[2] == 0x28) {
+		fused = (struct Instr){ .fn = fuse_cp_jr, .opcode = FUSE_CP_JR, .len = 4,
+			.imm = b[1] | b[3] << 8 };
+	} else if (b[0] == 0xf0 && b[2] == 0xe6) {
+		fused = (struct Instr){ .fn = fuse_ldh_and, .opcode = FUSE_LDH_AND, .len = 4,
+			.imm = b[1] | b[3] << 8 };
+	} else {
+		return 0;
+	}
 
-	return 2;
+	if (n > max || !cpu_cacheable(pc) || !cpu_cacheable(pc + fused.len - 1)
+			|| cpu_code_window(pc) != cpu_code_window(pc + fused.len - 1))
+		return 0;
+
+	for (int i = 0; i < fused.len; i += oplen[b[i]])
+		fused.cycles += opcycles[b[i]];
+	watch(cpu, pc);
+	watch(cpu, pc + fused.len - 1);
+
+	*in = fused;
+	return n;
+#else
+	(void)cpu;
+	(void)pc;
+	(void)in;
+	(void)max;
+	return 0;
+#endif /* FUSE */
 }
 
-static int
-set_b3_r8(struct CPU *cpu, uint8_t opcode)
-{
-	uint8_t *reg = parse_r8(cpu, opcode, 0);
-
-	uint8_t bit = (opcode >> 3) & 0b111;
+static const char *fuse_names[FUSE_COUNT] = {
+	[FUSE_COPY] = "ld a,[hl+]; ld [de],a; inc de",
+	[FUSE_DEC_JR] = "dec r8; jr nz",
+	[FUSE_CP_JR] = "cp n; jr z",
+	[FUSE_LDH_AND] = "ldh a,[n]; and m",
+};
 
-	*reg |= 1 << bit;
+void
+cpu_fuse_stats(struct CPU *cpu, FILE *f)
+{
+	for (int i = 0; i < FUSE_COUNT; i++)
+		fprintf(f, "fused %-32s %u\n", fuse_names[i], cpu->fused[i]);
+}
 
-	if ((opcode & 0b111) == m)
-		return 4;
+#ifdef OPSTATS
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define TSC() __rdtsc()
+#else
+#define TSC() 0 /* counts only */
+#endif
 
-	return 2;
+/* the row of the handler in, worked out from which table it came from */
+static int
+row(const struct Instr *in)
+{
+	if (in->fn == optable[in->opcode])
+		return in->opcode;
+	if (in->fn == cbtable[in->opcode])
+		return 256 + in->opcode;
+	return 512 + in->opcode; /* superinstructions keep their FUSION in opcode */
 }
 
-static int
-prefix(struct CPU *cpu)
+int
+cpu_call(struct CPU *cpu, const struct Instr *in)
 {
-	uint8_t opcode = mem_read(cpu->memory, cpu->pc++);
+	struct OpStats *st = cpu->opstats;
 
-	if ((opcode & 0b11111000) == 0) {
-		return rlc_r8(cpu, opcode);
-	}
+	if (st == NULL)
+		return in->fn(cpu, in);
 
-	if ((opcode & 0b11111000) == 0b1000) {
-		return rrc_r8(cpu, opcode);
-	}
+	uint64_t t = TSC();
+	int cycles = in->fn(cpu, in);
+	int r = row(in);
 
-	if ((opcode & 0b11111000) == 0b10000) {
-		return rl_r8(cpu, opcode);
-	}
+	st->tsc[r] += TSC() - t;
+	st->count[r]++;
 
-	if ((opcode & 0b11111000) == 0b11000) {
-		return rr_r8(cpu, opcode);
-	}
+	return cycles;
+}
+#endif /* OPSTATS */
 
-	if ((opcode & 0b11111000) == 0b100000) {
-		return sla_r8(cpu, opcode);
-	}
+/* the handler counts as csv, rows that never ran are left out */
+void
+cpu_opstats(struct CPU *cpu, FILE *f)
+{
+	const struct OpStats *st = cpu->opstats;
 
-	if ((opcode & 0b11111000) == 0b101000) {
-		return sra_r8(cpu, opcode);
-	}
+	if (st == NULL)
+		return;
 
-	if ((opcode & 0b11111000) == 0b110000) {
-		return swap_r8(cpu, opcode);
-	}
+	fprintf(f, "table,opcode,mnemonic,count,tsc,tsc_per_call\n");
+	for (int r = 0; r < OPSTATS_ROWS; r++) {
+		if (st->count[r] == 0)
+			continue;
 
-	if ((opcode & 0b11111000) == 0b111000) {
-		return srl_r8(cpu, opcode);
-	}
+		const char *table = r < 256 ? "base" : r < 512 ? "cb" : "fused";
+		uint8_t op[3] = {r, 0, 0};
+		if (r >= 256 && r < 512)
+			op[0] = 0xcb, op[1] = r - 256;
 
-	if (opcode >> 6 == 1) {
-		return bit_b3_r8(cpu, opcode);
+		char *mnemonic = r < 512 ? get_mnemonic(op) : NULL;
+		fprintf(f, "%s,0x%02x,\"%s\",%llu,%llu,%.1f\n", table, r & 0xff,
+			mnemonic != NULL ? mnemonic : fuse_names[r - 512],
+			(unsigned long long)st->count[r], (unsigned long long)st->tsc[r],
+			(double)st->tsc[r] / st->count[r]);
+		free(mnemonic);
 	}
+}
 
-	if (opcode >> 6 == 0b10) {
-		return res_b3_r8(cpu, opcode);
-	}
+static const struct Instr *
+fetch(struct CPU *cpu, struct Instr *tmp)
+{
+	uint16_t pc = cpu->pc;
+	struct Instr *in = tmp;
 
-	if (opcode >> 6 == 0b11) {
-		return set_b3_r8(cpu, opcode);
+	if (cpu->icache != NULL && cpu_cacheable(pc)) {
+		in = icache_at(cpu, pc);
+		if (in->fn != NULL)
+			return in;
+		if (cpu_crosses(cpu, pc))
+			in = tmp;
 	}
 
-	unimlemented_opcode(opcode);
+	cpu_decode(cpu, pc, in);
 
-	return 100;
+	return in;
 }
 
-/* TODO: cycles/timing */
 static int
 handle_interrupt(struct CPU *cpu)
 {
-	uint8_t flag = mem_read(cpu->memory, IF);
-	uint8_t enable = mem_read(cpu->memory, IE);
+	uint16_t vector = interrupt_ack(cpu->memory);
 
-	if (flag & INTERRUPT_VBLANK && enable & INTERRUPT_VBLANK) {
-		fprintf(cpu->log, "int %d ", INTERRUPT_VBLANK);
-		mem_write(cpu->memory, IF, flag & ~INTERRUPT_VBLANK);
-		cpu->ime = IME_UNSET;
-		cpu->pc -= 2;
-		call(cpu, 0x00, 0x40);
-		return 5;
-	}
+	if (vector == 0)
+		return 0;
+
+	cpu->ime = IME_UNSET;
+	call(cpu, vector);
+	return 5;
+}
+
+int
+cpu_execute(struct CPU *cpu)
+{
+	struct Instr tmp;
+	const struct Instr *in;
 
-	if (flag & INTERRUPT_STAT && enable & INTERRUPT_STAT) {
-		fprintf(cpu->log, "int %d ", INTERRUPT_STAT);
-		mem_write(cpu->memory, IF, flag & ~INTERRUPT_STAT);
-		cpu->ime = IME_UNSET;
-		cpu->pc -= 2;
-		call(cpu, 0x00, 0x48);
-		return 5;
+	if (cpu->halt || cpu->stop) {
+		/* an idle mcycle until something is pending */
+		if (!interrupt_pending(cpu->memory))
+			return 1;
+		cpu->halt = cpu->stop = 0;
 	}
 
-	if (flag & INTERRUPT_TIMER && enable & INTERRUPT_TIMER) {
-		fprintf(cpu->log, "int %d ", INTERRUPT_TIMER);
-		mem_write(cpu->memory, IF, flag & ~INTERRUPT_TIMER);
-		cpu->ime = IME_UNSET;
-		cpu->pc -= 2;
-		call(cpu, 0x00, 0x50);
-		return 5;
+	if (!cpu->halt_bug) {
+		in = fetch(cpu, &tmp);
+		cpu->pc += in->len;
+		return CPU_CALL(cpu, in);
 	}
 
-	if (flag & INTERRUPT_SERIAL && enable & INTERRUPT_SERIAL) {
-		fprintf(cpu->log, "int %d ", INTERRUPT_SERIAL);
-		mem_write(cpu->memory, IF, flag & ~INTERRUPT_SERIAL);
-		cpu->ime = IME_UNSET;
+	/* pc doesn't advance, so the opcode is read again as its own operand */
+	cpu->halt_bug = 0;
+	uint8_t bytes[3] = {
+		cpu_peek(cpu, cpu->pc),
+		cpu_peek(cpu, cpu->pc),
+		cpu_peek(cpu, cpu->pc + 1),
+	};
+	decode(&tmp, bytes);
+	cpu->pc += tmp.len - 1;
 
-		cpu->pc -= 2;
-		call(cpu, 0x00, 0x58);
-		return 5;
-	}
+	return CPU_CALL(cpu, &tmp);
+}
 
-	if (flag & INTERRUPT_JOYPAD && enable & INTERRUPT_JOYPAD) {
-		fprintf(cpu->log, "int %d ", INTERRUPT_JOYPAD);
-		mem_write(cpu->memory, IF, flag & ~INTERRUPT_JOYPAD);
-		cpu->ime = IME_UNSET;
-		cpu->pc -= 2;
-		call(cpu, 0x00, 0x60);
-		return 5;
-	}
+/* no link cable, the other side shifts in ones */
+static void
+serial_done(struct CPU *cpu)
+{
+	cpu->memory[SB] = 0xff;
+	cpu->memory[SC] &= 0x7f;
+	interrupt_request(cpu->memory, INTERRUPT_SERIAL);
+}
 
-	return 0;
+/* copied in one go at the end, the ppu has no use for half of it */
+static void
+dma_done(struct CPU *cpu)
+{
+	uint16_t src = cpu->memory[DMA] << 8;
+
+	if (src >= 0xe000)
+		src -= 0x2000;
+	/* src is page aligned, so the whole copy is in one page */
+	const uint8_t *p = cpu->bus->rd[src >> 8];
+	memcpy(&cpu->memory[OAM], p != NULL ? p : &cpu->memory[src], 0xa0);
 }
 
-int
-cpu_execute(struct CPU *cpu)
+/* an event kind n mcycles from now, INT_MAX meaning never */
+static void
+schedule(struct CPU *cpu, enum EVENT kind, int n)
 {
-	uint8_t opcode = mem_read(cpu->memory, cpu->pc);
+	if (n == INT_MAX)
+		sched_cancel(&cpu->sched, kind);
+	else
+		sched_set(&cpu->sched, kind, cpu->mcycles + n);
+}
 
-	if (cpu->halt) {
-		if (mem_read(cpu->memory, IE) & mem_read(cpu->memory, IF)) {
-			cpu->halt = 0;
-			if (cpu->ime == 0)
-				goto halt_bug; /* TODO: actually test halt bug */
+/*
+ * runs the timer and ppu up to mcycles and schedules the first mcycle
+ * either could raise an interrupt, then handles the events that are due.
+ * nothing else they do is visible before the cpu reads or writes what they
+ * share, see io_reads and io_writes
+ */
+void
+cpu_catchup(struct CPU *cpu)
+{
+	timer_catchup(cpu);
+	schedule(cpu, EVENT_TIMER, timer_next_interrupt(cpu));
+	if (cpu->ppu != NULL)
+		schedule(cpu, EVENT_PPU, ppu_catchup(cpu->ppu, cpu->mcycles));
+
+	/* ppu and timer were just moved ahead, unless there is no ppu */
+	int kind;
+	while ((kind = sched_pop(&cpu->sched, cpu->mcycles)) >= 0) {
+		switch (kind) {
+			case EVENT_SERIAL:
+				serial_done(cpu);
+				break;
+			case EVENT_DMA:
+				dma_done(cpu);
+				break;
 		}
 	}
+}
 
-	if (!cpu->halt && !cpu->stop)
-		cpu->pc++;
-halt_bug:
+void
+check_interrupts(struct CPU *cpu)
+{
+	if (cpu_due(cpu))
+		cpu_catchup(cpu);
 
-	switch (opcode) {
-		case 0x00: /* NOP */
-			return 1;
-		break;
-		case 0x01:
-			return ld_r16_imm16(cpu, opcode);
-		break;
-		case 0x02:
-			return ld_r16mem_a(cpu, opcode);
-		break;
-		case 0x03:
-			return inc_r16(cpu, opcode);
-		break;
-		case 0x04:
-			return inc_r8(cpu, opcode);
-		break;
-		case 0x05:
-			return dec_r8(cpu, opcode);
-		break;
-		case 0x06:
-			return ld_r8_imm8(cpu, opcode);
-		break;
-		case 0x07:
-			return bit_shift(cpu, opcode);
-		break;
-		case 0x08:
-			return ld_imm16_sp(cpu);
-		break;
-		case 0x09:
-			return add_hl_r16(cpu, opcode);
-		break;
-		case 0x0a:
-			return ld_a_r16mem(cpu, opcode);
-		break;
-		case 0x0b:
-			return dec_r16(cpu, opcode);
-		break;
-		case 0x0c:
-			return inc_r8(cpu, opcode);
-		break;
-		case 0x0d:
-			return dec_r8(cpu, opcode);
-		break;
-		case 0x0e:
-			return ld_r8_imm8(cpu, opcode);
-		break;
-		case 0x0f:
-			return bit_shift(cpu, opcode);
-		break;
-		case 0x10:
-			return stop(cpu);
-		break;
-		case 0x11:
-			return ld_r16_imm16(cpu, opcode);
-		break;
-		case 0x12:
-			return ld_r16mem_a(cpu, opcode);
-		break;
-		case 0x13:
-			return inc_r16(cpu, opcode);
-		break;
-		case 0x14:
-			return inc_r8(cpu, opcode);
-		break;
-		case 0x15:
-			return dec_r8(cpu, opcode);
-		break;
-		case 0x16:
-			return ld_r8_imm8(cpu, opcode);
-		break;
-		case 0x17:
-			return bit_shift(cpu, opcode);
-		break;
-		case 0x18:
-			return jr_imm8(cpu, opcode);
-		break;
-		case 0x19:
-			return add_hl_r16(cpu, opcode);
-		break;
-		case 0x1a:
-			return ld_a_r16mem(cpu, opcode);
-		break;
-		case 0x1b:
-			return dec_r16(cpu, opcode);
-		break;
-		case 0x1c:
-			return inc_r8(cpu, opcode);
-		break;
-		case 0x1d:
-			return dec_r8(cpu, opcode);
-		break;
-		case 0x1e:
-			return ld_r8_imm8(cpu, opcode);
-		break;
-		case 0x1f:
-			return bit_shift(cpu, opcode);
-		break;
-		case 0x20:
-			return jr_imm8(cpu, opcode);
-		break;
-		case 0x21:
-			return ld_r16_imm16(cpu, opcode);
-		break;
-		case 0x22:
-			return ld_r16mem_a(cpu, opcode);
-		break;
-		case 0x23:
-			return inc_r16(cpu, opcode);
-		break;
-		case 0x24:
-			return inc_r8(cpu, opcode);
-		break;
-		case 0x25:
-			return dec_r8(cpu, opcode);
-		break;
-		case 0x26:
-			return ld_r8_imm8(cpu, opcode);
-		break;
-		case 0x27:
-			return bit_shift(cpu, opcode);
-		break;
-		case 0x28:
-			return jr_imm8(cpu, opcode);
-		break;
-		case 0x29:
-			return add_hl_r16(cpu, opcode);
-		break;
-		case 0x2a:
-			return ld_a_r16mem(cpu, opcode);
-		break;
-		case 0x2b:
-			return dec_r16(cpu, opcode);
-		break;
-		case 0x2c:
-			return inc_r8(cpu, opcode);
-		break;
-		case 0x2d:
-			return dec_r8(cpu, opcode);
-		break;
-		case 0x2e:
-			return ld_r8_imm8(cpu, opcode);
-		break;
-		case 0x2f:
-			return bit_shift(cpu, opcode);
-		break;
-		case 0x30:
-			return jr_imm8(cpu, opcode);
-		break;
-		case 0x31:
-			return ld_r16_imm16(cpu, opcode);
-		break;
-		case 0x32:
-			return ld_r16mem_a(cpu, opcode);
-		break;
-		case 0x33:
-			return inc_r16(cpu, opcode);
-		break;
-		case 0x34:
-			return inc_r8(cpu, opcode);
-		break;
-		case 0x35:
-			return dec_r8(cpu, opcode);
-		break;
-		case 0x36:
-			return ld_r8_imm8(cpu, opcode);
-		break;
-		case 0x37:
-			return bit_shift(cpu, opcode);
-		break;
-		case 0x38:
-			return jr_imm8(cpu, opcode);
-		break;
-		case 0x39:
-			return add_hl_r16(cpu, opcode);
-		break;
-		case 0x3a:
-			return ld_a_r16mem(cpu, opcode);
-		break;
-		case 0x3b:
-			return dec_r16(cpu, opcode);
-		break;
-		case 0x3c:
-			return inc_r8(cpu, opcode);
-		break;
-		case 0x3d:
-			return dec_r8(cpu, opcode);
-		break;
-		case 0x3e:
-			return ld_r8_imm8(cpu, opcode);
-		break;
-		case 0x3f:
-			return bit_shift(cpu, opcode);
-		break;
-		case 0x40:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x41:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x42:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x43:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x44:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x45:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x46:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x47:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x48:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x49:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x4a:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x4b:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x4c:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x4d:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x4e:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x4f:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x50:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x51:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x52:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x53:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x54:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x55:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x56:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x57:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x58:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x59:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x5a:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x5b:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x5c:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x5d:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x5e:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x5f:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x60:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x61:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x62:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x63:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x64:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x65:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x66:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x67:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x68:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x69:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x6a:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x6b:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x6c:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x6d:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x6e:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x6f:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x70:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x71:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x72:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x73:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x74:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x75:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x76:
-			return halt(cpu);
-		break;
-		case 0x77:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x78:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x79:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x7a:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x7b:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x7c:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x7d:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x7e:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x7f:
-			return ld_r8_r8(cpu, opcode);
-		break;
-		case 0x80:
-			return add_r8(cpu, opcode);
-		break;
-		case 0x81:
-			return add_r8(cpu, opcode);
-		break;
-		case 0x82:
-			return add_r8(cpu, opcode);
-		break;
-		case 0x83:
-			return add_r8(cpu, opcode);
-		break;
-		case 0x84:
-			return add_r8(cpu, opcode);
-		break;
-		case 0x85:
-			return add_r8(cpu, opcode);
-		break;
-		case 0x86:
-			return add_r8(cpu, opcode);
-		break;
-		case 0x87:
-			return add_r8(cpu, opcode);
-		break;
-		case 0x88:
-			return adc_r8(cpu, opcode);
-		break;
-		case 0x89:
-			return adc_r8(cpu, opcode);
-		break;
-		case 0x8a:
-			return adc_r8(cpu, opcode);
-		break;
-		case 0x8b:
-			return adc_r8(cpu, opcode);
-		break;
-		case 0x8c:
-			return adc_r8(cpu, opcode);
-		break;
-		case 0x8d:
-			return adc_r8(cpu, opcode);
-		break;
-		case 0x8e:
-			return adc_r8(cpu, opcode);
-		break;
-		case 0x8f:
-			return adc_r8(cpu, opcode);
-		break;
-		case 0x90:
-			return sub_r8(cpu, opcode);
-		break;
-		case 0x91:
-			return sub_r8(cpu, opcode);
-		break;
-		case 0x92:
-			return sub_r8(cpu, opcode);
-		break;
-		case 0x93:
-			return sub_r8(cpu, opcode);
-		break;
-		case 0x94:
-			return sub_r8(cpu, opcode);
-		break;
-		case 0x95:
-			return sub_r8(cpu, opcode);
-		break;
-		case 0x96:
-			return sub_r8(cpu, opcode);
-		break;
-		case 0x97:
-			return sub_r8(cpu, opcode);
-		break;
-		case 0x98:
-			return sbc_r8(cpu, opcode);
-		break;
-		case 0x99:
-			return sbc_r8(cpu, opcode);
-		break;
-		case 0x9a:
-			return sbc_r8(cpu, opcode);
-		break;
-		case 0x9b:
-			return sbc_r8(cpu, opcode);
-		break;
-		case 0x9c:
-			return sbc_r8(cpu, opcode);
-		break;
-		case 0x9d:
-			return sbc_r8(cpu, opcode);
-		break;
-		case 0x9e:
-			return sbc_r8(cpu, opcode);
-		break;
-		case 0x9f:
-			return sbc_r8(cpu, opcode);
-		break;
-		case 0xa0:
-			return and_r8(cpu, opcode);
-		break;
-		case 0xa1:
-			return and_r8(cpu, opcode);
-		break;
-		case 0xa2:
-			return and_r8(cpu, opcode);
-		break;
-		case 0xa3:
-			return and_r8(cpu, opcode);
-		break;
-		case 0xa4:
-			return and_r8(cpu, opcode);
-		break;
-		case 0xa5:
-			return and_r8(cpu, opcode);
-		break;
-		case 0xa6:
-			return and_r8(cpu, opcode);
-		break;
-		case 0xa7:
-			return and_r8(cpu, opcode);
-		break;
-		case 0xa8:
-			return xor_r8(cpu, opcode);
-		break;
-		case 0xa9:
-			return xor_r8(cpu, opcode);
-		break;
-		case 0xaa:
-			return xor_r8(cpu, opcode);
-		break;
-		case 0xab:
-			return xor_r8(cpu, opcode);
-		break;
-		case 0xac:
-			return xor_r8(cpu, opcode);
-		break;
-		case 0xad:
-			return xor_r8(cpu, opcode);
-		break;
-		case 0xae:
-			return xor_r8(cpu, opcode);
-		break;
-		case 0xaf:
-			return xor_r8(cpu, opcode);
-		break;
-		case 0xb0:
-			return or_r8(cpu, opcode);
-		break;
-		case 0xb1:
-			return or_r8(cpu, opcode);
-		break;
-		case 0xb2:
-			return or_r8(cpu, opcode);
-		break;
-		case 0xb3:
-			return or_r8(cpu, opcode);
-		break;
-		case 0xb4:
-			return or_r8(cpu, opcode);
-		break;
-		case 0xb5:
-			return or_r8(cpu, opcode);
-		break;
-		case 0xb6:
-			return or_r8(cpu, opcode);
-		break;
-		case 0xb7:
-			return or_r8(cpu, opcode);
-		break;
-		case 0xb8:
-			return cp_r8(cpu, opcode);
-		break;
-		case 0xb9:
-			return cp_r8(cpu, opcode);
-		break;
-		case 0xba:
-			return cp_r8(cpu, opcode);
-		break;
-		case 0xbb:
-			return cp_r8(cpu, opcode);
-		break;
-		case 0xbc:
-			return cp_r8(cpu, opcode);
-		break;
-		case 0xbd:
-			return cp_r8(cpu, opcode);
-		break;
-		case 0xbe:
-			return cp_r8(cpu, opcode);
-		break;
-		case 0xbf:
-			return cp_r8(cpu, opcode);
-		break;
-		case 0xc0:
-			return ret_cond(cpu, opcode);
-		break;
-		case 0xc1:
-			return pop_r16stk(cpu, opcode);
-		break;
-		case 0xc2:
-			return jp_cond(cpu, opcode);
-		break;
-		case 0xc3:
-			return jp_a16(cpu);
-		break;
-		case 0xc4:
-			return call_cond(cpu, opcode);
-		break;
-		case 0xc5:
-			return push_r16stk(cpu, opcode);
-		break;
-		case 0xc6:
-			return add_imm8(cpu, mem_read(cpu->memory, cpu->pc));
-		break;
-		case 0xc7:
-			return rst(cpu, opcode);
-		break;
-		case 0xc8:
-			return ret_cond(cpu, opcode);
-		break;
-		case 0xc9:
-			return ret(cpu);
-		break;
-		case 0xca:
-			return jp_cond(cpu, opcode);
-		break;
-		case 0xcb:
-			return prefix(cpu);
-		break;
-		case 0xcc:
-			return call_cond(cpu, opcode);
-		break;
-		case 0xcd:
-			return call_a16(cpu);
-		break;
-		case 0xce:
-			return adc_imm8(cpu, mem_read(cpu->memory, cpu->pc));
-		break;
-		case 0xcf:
-			return rst(cpu, opcode);
-		break;
-		case 0xd0:
-			return ret_cond(cpu, opcode);
-		break;
-		case 0xd1:
-			return pop_r16stk(cpu, opcode);
-		break;
-		case 0xd2:
-			return jp_cond(cpu, opcode);
-		break;
-		case 0xd3:
-			fprintf(stderr, "0xd3 illigal opcode\n");
-			exit(1);
-		break;
-		case 0xd4:
-			return call_cond(cpu, opcode);
-		break;
-		case 0xd5:
-			return push_r16stk(cpu, opcode);
-		break;
-		case 0xd6:
-			return sub_imm8(cpu, mem_read(cpu->memory, cpu->pc));
-		break;
-		case 0xd7:
-			return rst(cpu, opcode);
-		break;
-		case 0xd8:
-			return ret_cond(cpu, opcode);
-		break;
-		case 0xd9:
-			return reti(cpu);
-		break;
-		case 0xda:
-			return jp_cond(cpu, opcode);
-		break;
-		case 0xdb:
-			fprintf(stderr, "0xdb illigal opcode\n");
-			exit(1);
-		break;
-		case 0xdc:
-			return call_cond(cpu, opcode);
-		break;
-		case 0xdd:
-			fprintf(stderr, "0xdd illigal opcode\n");
-			exit(1);
-		break;
-		case 0xde:
-			return sbc_imm8(cpu, mem_read(cpu->memory, cpu->pc));
-		break;
-		case 0xdf:
-			return rst(cpu, opcode);
-		break;
-		case 0xe0:
-			return ldh(cpu, opcode);
-		break;
-		case 0xe1:
-			return pop_r16stk(cpu, opcode);
-		break;
-		case 0xe2:
-			return ldh(cpu, opcode);
-		break;
-		case 0xe3:
-			fprintf(stderr, "0xe3 illigal opcode\n");
-			exit(1);
-		break;
-		case 0xe4:
-			fprintf(stderr, "0xe4 illigal opcode\n");
-			exit(1);
-		break;
-		case 0xe5:
-			return push_r16stk(cpu, opcode);
-		break;
-		case 0xe6:
-			return and_imm8(cpu, mem_read(cpu->memory, cpu->pc));
-		break;
-		case 0xe7:
-			return rst(cpu, opcode);
-		break;
-		case 0xe8:
-			return add_sp_imm8(cpu);
-		break;
-		case 0xe9:
-			return jp_hl(cpu);
-		break;
-		case 0xea:
-			return ldh(cpu, opcode);
-		break;
-		case 0xeb:
-			fprintf(stderr, "0xeb illigal opcode\n");
-			exit(1);
-		break;
-		case 0xec:
-			fprintf(stderr, "0xec illigal opcode\n");
-			exit(1);
-		break;
-		case 0xed:
-			fprintf(stderr, "0xed illigal opcode\n");
-			exit(1);
-		break;
-		case 0xee:
-			return xor_imm8(cpu, mem_read(cpu->memory, cpu->pc));
-		break;
-		case 0xef:
-			return rst(cpu, opcode);
-		break;
-		case 0xf0:
-			return ldh(cpu, opcode);
-		break;
-		case 0xf1:
-			return pop_r16stk(cpu, opcode);
-		break;
-		case 0xf2:
-			return ldh(cpu, opcode);
-		break;
-		case 0xf3:
-			return di(cpu);
-		break;
-		case 0xf4:
-			fprintf(stderr, "0xf4 illigal opcode\n");
-			exit(1);
-		break;
-		case 0xf5:
-			return push_r16stk(cpu, opcode);
-		break;
-		case 0xf6:
-			return or_imm8(cpu, mem_read(cpu->memory, cpu->pc));
-		break;
-		case 0xf7:
-			return rst(cpu, opcode);
-		break;
-		case 0xf8:
-			return ldh(cpu, opcode);
-		break;
-		case 0xf9:
-			return ld_sp_hl(cpu);
-		break;
-		case 0xfa:
-			return ldh(cpu, opcode);
-		break;
-		case 0xfb:
-			return ei(cpu);
-		break;
-		case 0xfc:
-			fprintf(stderr, "0xfc illigal opcode\n");
-			exit(1);
-		break;
-		case 0xfd:
-			fprintf(stderr, "0xfd illigal opcode\n");
-			exit(1);
-		break;
-		case 0xfe:
-			return cp_imm8(cpu, mem_read(cpu->memory, cpu->pc));
-		break;
-		case 0xff:
-			return rst(cpu, opcode);
-		break;
-		default:
-			unimlemented_opcode(opcode);
-		break;
+	if (cpu->ime == IME_SET) {
+		if (handle_interrupt(cpu)) {
+			cpu->mcycles += 5;
+			cpu->interrupts++;
+			cpu->halt = 0;
+		}
 	}
-	return 0;
 }
 
 int
@@ -2135,50 +1796,73 @@ execute(struct CPU *cpu)
 
 	uint8_t cycles = cpu_execute(cpu);
 	cpu->mcycles += cycles;
-	timer_incr(cpu, cycles);
+	check_interrupts(cpu);
 
-	if (cpu->ime == IME_SET) {
-		if (handle_interrupt(cpu)) {
-			cpu->mcycles += 5;
-		}
-	}
 	return cycles;
 }
 
-void
-cpu_log(struct CPU *cpu)
+/* same as execute() but only checks interrupts between blocks */
+int
+execute_block(struct CPU *cpu)
 {
-	fprintf(cpu->log, "A: %02X F: %02X B: %02X C: %02X D: %02X E: %02X H: %02X "
-		 "L: %02X SP: %04X PC: 00:%04X (%02X %02X %02X %02X)\n",
-		cpu->a, cpu->f.flags, cpu->b, cpu->c, cpu->d, cpu->e, cpu->h, cpu->l,
-		cpu->sp, cpu->pc, cpu->memory[cpu->pc], cpu->memory[cpu->pc+1],
-		cpu->memory[cpu->pc+2], cpu->memory[cpu->pc+3]);
+	/* ei, halt and stop are handled an instruction at a time */
+	if (cpu->ime == IME_NEXT || cpu->halt || cpu->stop || cpu->halt_bug)
+		return execute(cpu);
+
+	int cycles = cpu_execute_block(cpu, BLOCK_MAX);
+	check_interrupts(cpu);
+
+	return cycles;
 }
 
-void
-print_cpu_state(struct CPU *cpu)
+#ifdef JIT
+/* translated blocks chain among themselves, interrupts are checked on return */
+int
+execute_jit(struct CPU *cpu)
 {
-	fprintf(cpu->log, "%13s|", get_mnemonic(&cpu->memory[cpu->pc]));
-	fprintf(cpu->log, "DIV: %08d ", mem_read(cpu->memory, DIV));
-	fprintf(cpu->log, "CYC: %05d ", cpu->mcycles);
-	fprintf(cpu->log, "TAC: %03b TIMA: %02x ", mem_read(cpu->memory, TAC), mem_read(cpu->memory, TIMA));
+	if (cpu->jit == NULL || cpu->ime == IME_NEXT || cpu->halt || cpu->stop || cpu->halt_bug)
+		return execute(cpu);
 
-	fprintf(cpu->log, "%c%c%c%c ",
-		 cpu->f.z ? 'z' : '-', cpu->f.n ? 'n' : '-', cpu->f.h ? 'h' : '-',
-		 cpu->f.c ? 'c' : '-');
-	fprintf(cpu->log, "IME: %d IF: %05b IE: %05b ", cpu->ime, mem_read(cpu->memory, IF),
-		 mem_read(cpu->memory, IE));
+	int cycles = cpu_execute_jit(cpu);
+	check_interrupts(cpu);
 
-	fprintf(cpu->log, "AF: %02x%02x BC: %02x%02x DE: %02x%02x HL: %02x%02x "
-		 "SP: %04x PC: %04x ", cpu->a, cpu->f.flags, cpu->b, cpu->c, cpu->d,
-		 cpu->e, cpu->h, cpu->l, cpu->sp, cpu->pc);
+	return cycles;
+}
+#endif /* JIT */
 
-	fprintf(cpu->log, "[HL]: %02x ", mem_read(cpu->memory, cpu->h << 8 | cpu->l));
-	fprintf(cpu->log, "[%02x %02x %02x %02x] ", mem_read(cpu->memory, cpu->sp),
-		 mem_read(cpu->memory, cpu->sp+1), mem_read(cpu->memory, cpu->sp+2), mem_read(cpu->memory, cpu->sp+3));
+const char *const cpu_engines[ENGINES] = {
+	[ENGINE_INTERP] = "interp",
+	[ENGINE_BLOCK] = "block",
+	[ENGINE_JIT] = "jit",
+};
 
-	fprintf(cpu->log, "(%02x %02x %02x %02x)", mem_read(cpu->memory, cpu->pc),
-		 mem_read(cpu->memory, cpu->pc+1), mem_read(cpu->memory, cpu->pc+2), mem_read(cpu->memory, cpu->pc+3));
+/* -1 for an unknown engine or one that isn't built in */
+int
+cpu_engine(const char *name)
+{
+	for (int i = 0; i < ENGINES; i++) {
+#ifndef JIT
+		if (i == ENGINE_JIT)
+			continue;
+#endif
+		if (strcmp(name, cpu_engines[i]) == 0)
+			return i;
+	}
+	return -1;
+}
 
-	fprintf(cpu->log, "\n");
+/* one instruction on cpu->engine, untimed like cpu_execute, for cpus without tables (tests) */
+int
+cpu_step(struct CPU *cpu)
+{
+	switch (cpu->engine) {
+		case ENGINE_BLOCK:
+			return cpu_execute_block(cpu, 1);
+#ifdef JIT
+		case ENGINE_JIT:
+			return cpu_execute_jit(cpu);
+#endif
+		default:
+			return cpu_execute(cpu);
+	}
 }
@@ -2,6 +2,8 @@
 #define CPU_H
 #include <stdint.h>
 #include <stdio.h>
+#include "cart.h"
+#include "sched.h"
 
 enum r16 {
 	bc,
@@ -51,12 +53,30 @@ union Flags {
 	uint8_t flags;
 };
 
+/* alu ops whose flags can be worked out later, see cpu_sync_flags */
+enum LAZY_OP {
+	LAZY_NONE, /* f is up to date */
+	LAZY_ADD, /* add, adc */
+	LAZY_SUB, /* sub, sbc, cp */
+	LAZY_AND,
+	LAZY_OR, /* or, xor */
+	LAZY_INC,
+	LAZY_DEC,
+};
+
+struct Lazy {
+	uint8_t op;
+	uint8_t x, y, res;
+	uint8_t c; /* carry in for adc/sbc, carry kept by inc/dec */
+};
+
 enum {
 	IE = 0xFFFF,
 	IF = 0xFF0F,
 
 	SB = 0xFF01,
 	SC = 0xFF02,
+	DMA = 0xFF46,
 };
 
 enum INTERRUPT {
@@ -74,107 +94,193 @@ enum IME_STATE {
 };
 
 
+struct CPU;
+struct Block;
+struct Cart;
+struct Jit;
+struct JitBlock;
+struct PPU;
+
+enum ENGINE {
+	ENGINE_INTERP,
+	ENGINE_BLOCK,
+	ENGINE_JIT,
+	ENGINES,
+};
+
+/* superinstructions built by cpu_fuse, with -D FUSE */
+enum FUSION {
+	FUSE_COPY, /* ld a,[hl+]; ld [de],a; inc de */
+	FUSE_DEC_JR, /* dec r8; jr nz */
+	FUSE_CP_JR, /* cp n; jr z */
+	FUSE_LDH_AND, /* ldh a,[n]; and m */
+	FUSE_COUNT,
+};
+
+/* why the running block stops after this instruction, or'd into cpu->smc */
+enum SMC {
+	SMC_WRITTEN = 1, /* cur_block was written to, freed once it stops */
+	SMC_REMAPPED = 2, /* another bank was mapped under it, see cpu_rom_mapped */
+	SMC_IO = 4, /* an io register or IE was written, interrupts may have changed */
+};
+
+/* a decoded instruction, cached by pc */
+struct Instr {
+	int (*fn)(struct CPU *cpu, const struct Instr *in);
+	uint16_t imm;
+	uint8_t opcode; /* the byte after the prefix for cb opcodes */
+	uint8_t len;
+	uint8_t cycles; /* base cost, taken branches add to it */
+	uint8_t dst, src; /* r8 operands */
+};
+
+/* handler calls by row: base opcodes, cb opcodes, then superinstructions */
+#define OPSTATS_ROWS (512 + FUSE_COUNT)
+struct OpStats {
+	uint64_t count[OPSTATS_ROWS];
+	uint64_t tsc[OPSTATS_ROWS]; /* host cycles spent in the handler */
+};
+
+/* how every engine runs a decoded instruction, counted with -D OPSTATS */
+#ifdef OPSTATS
+int cpu_call(struct CPU *cpu, const struct Instr *in);
+#define CPU_CALL(cpu, in) cpu_call(cpu, in)
+#else
+#define CPU_CALL(cpu, in) (in)->fn(cpu, in)
+#endif
+
+/* addresses written by the cpu, for lockstep */
+#define WRITES_MAX 256
+struct Writes {
+	uint16_t adr[WRITES_MAX];
+	int n;
+};
+
+/*
+ * the address space as 256 pages of 256 bytes. plain memory is read or
+ * written through the page's host pointer, the rest (io, rom writes for the
+ * mbc, video memory the ppu may be behind on, pages holding cached code)
+ * through its handler, see cpu_map
+ */
+struct Bus {
+	uint8_t *rd[256]; /* NULL to call read[] */
+	uint8_t *wr[256]; /* NULL to call write[] */
+	uint8_t (*read[256])(struct CPU *cpu, uint16_t adr);
+	void (*write[256])(struct CPU *cpu, uint16_t adr, uint8_t data);
+};
+
+/*
+ * what was decoded from one rom bank in one window. a bank switch only
+ * points the window at another of these, so code from a bank that comes
+ * back is still decoded, built and translated, see cpu_rom_mapped
+ */
+struct BankCode {
+	struct Instr icache[ROM_BANK];
+	struct Block *blocks[ROM_BANK];
+	struct JitBlock *jit[ROM_BANK]; /* only with -D JIT */
+	uint8_t heat[ROM_BANK]; /* with jit, runs of each block before it is translated */
+};
+
+/* a register pair whose 8-bit halves alias the 16-bit word */
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define PAIR(hi_t, hi, lo_t, lo) \
+	union { struct { hi_t hi; lo_t lo; }; uint16_t hi##lo; }
+#else
+#define PAIR(hi_t, hi, lo_t, lo) \
+	union { struct { lo_t lo; hi_t hi; }; uint16_t hi##lo; }
+#endif
+
 struct CPU {
 	// registers
-	uint8_t a;
-	union Flags f;
-	uint8_t b,c;
-	uint8_t d,e;
-	uint8_t h,l;
+	PAIR(uint8_t, a, union Flags, f);
+	PAIR(uint8_t, b, uint8_t, c);
+	PAIR(uint8_t, d, uint8_t, e);
+	PAIR(uint8_t, h, uint8_t, l);
 	uint16_t sp, pc;
+	struct Lazy lazy; /* only pending with -D LAZY_FLAGS */
 
 	int8_t ime;
 
 	uint8_t halt;
 	uint8_t stop;
+	uint8_t halt_bug; /* next opcode byte is read twice */
 
 	uint8_t *memory;
-	uint32_t mcycles;
-
-	uint16_t div;
-
-	FILE *log;
-};
-
-
-#define get_r16(h, l) \
-	reg = (h << 8) | l; \
-	high = &h; \
-	low = &l; \
-
-#define set_r8_from_r16() \
-if (op == sp) { \
-	cpu->sp = reg; \
-} else { \
-	*high = reg >> 8; \
-	*low = reg & 0xff; \
-} \
-
-#define set_regs_r16mem(mask, shift) \
-int op = (opcode & mask) >> shift; \
-uint16_t reg = 0; \
-uint8_t *high, *low; \
-high = low = NULL; \
-\
-switch (op) { \
-	case bc: \
-		get_r16(cpu->b, cpu->c); \
-		break; \
-	case de: \
-		get_r16(cpu->d, cpu->e); \
-		break; \
-	case hli: \
-	case hld: \
-		get_r16(cpu->h, cpu->l); \
-		break; \
-}; \
-
-#define set_regs_r16(mask, shift) \
-int op = (opcode & mask) >> shift; \
-uint16_t reg = 0; \
-uint8_t *high, *low; \
-high = low = NULL; \
-\
-switch (op) { \
-	case bc: \
-		get_r16(cpu->b, cpu->c); \
-		break; \
-	case de: \
-		get_r16(cpu->d, cpu->e); \
-		break; \
-	case hl: \
-		get_r16(cpu->h, cpu->l); \
-		break; \
-	case sp: \
-		reg = cpu->sp; \
-		break; \
-}; \
-
-#define set_regs_r16stk(mask, shift) \
-int op = (opcode & mask) >> shift; \
-uint16_t reg = 0; \
-uint8_t *high, *low; \
-high = low = NULL; \
-\
-switch (op) { \
-	case s_bc: \
-		get_r16(cpu->b, cpu->c); \
-		break; \
-	case s_de: \
-		get_r16(cpu->d, cpu->e); \
-		break; \
-	case s_hl: \
-		get_r16(cpu->h, cpu->l); \
-		break; \
-	case s_af: \
-		get_r16(cpu->a, cpu->f.flags); \
-		break; \
-}; \
+	struct Bus *bus; /* over memory, see cpu_map */
+	struct Cart *cart; /* NULL in tests */
+	struct Instr *icache;
+	struct Block **blocks;
+	struct BankCode *rom_code[2]; /* of the banks mapped now, NULL to use the tables above */
+	struct BankCode **bank_code; /* by window then bank, each allocated when first mapped */
+	uint8_t *code; /* number of blocks covering each byte outside rom_code */
+	struct Block *cur_block;
+	struct Jit *jit; /* only with -D JIT */
+	uint8_t smc; /* SMC_*, cleared when a block starts */
+	enum ENGINE engine;
+	uint64_t mcycles; /* the master clock */
+	uint32_t interrupts; /* dispatched so far */
+	uint32_t fused[FUSE_COUNT]; /* superinstructions run */
+
+	/* the timer and ppu lag behind mcycles until something looks, see cpu_catchup */
+	struct PPU *ppu; /* NULL in tests */
+	struct Sched sched;
+	uint64_t timer_at; /* mcycles the timer has been run up to */
+
+	uint16_t div; /* counts tcycles, DIV is its top byte */
+	struct Writes *writes; /* NULL unless running in lockstep */
+	struct OpStats *opstats; /* only with -D OPSTATS, one per cpu */
+};
+
 
 struct CPU *init_cpu(uint8_t *mem);
+void cpu_free_tables(struct CPU *cpu);
+void cpu_map(struct Bus *bus, uint8_t *mem);
 int execute(struct CPU *cpu);
+int execute_block(struct CPU *cpu);
+int execute_jit(struct CPU *cpu);
 int cpu_execute(struct CPU *cpu);
+void check_interrupts(struct CPU *cpu);
+void cpu_catchup(struct CPU *cpu);
+int cpu_cacheable(uint16_t adr);
+int cpu_crosses(const struct CPU *cpu, uint16_t pc);
+void cpu_decode(struct CPU *cpu, uint16_t pc, struct Instr *in);
+void cpu_invalidate(struct CPU *cpu, uint16_t adr, int len);
+void cpu_rom_mapped(struct CPU *cpu, int window, int bank);
+int cpu_fuse(struct CPU *cpu, uint16_t pc, struct Instr *in, int max);
+void cpu_fuse_stats(struct CPU *cpu, FILE *f);
+void cpu_opstats(struct CPU *cpu, FILE *f);
+int cpu_engine(const char *name);
+extern const char *const cpu_engines[ENGINES];
+int cpu_step(struct CPU *cpu);
+void cpu_sync_flags(struct CPU *cpu);
 int execute_opcode(struct CPU *cpu);
-void cpu_log(struct CPU *cpu);
-void print_cpu_state(struct CPU *cpu);
+
+/* a byte as the bus would read it, without what reading io does */
+static inline uint8_t
+cpu_peek(const struct CPU *cpu, uint16_t adr)
+{
+	const uint8_t *p = cpu->bus->rd[adr >> 8];
+	return p != NULL ? p[adr & 0xff] : cpu->memory[adr];
+}
+
+/* the per bank tables that hold what is decoded at pc, NULL for the flat ones */
+static inline struct BankCode *
+cpu_bank_code(const struct CPU *cpu, uint16_t pc)
+{
+	return pc < 0x8000 ? cpu->rom_code[pc >> 14] : NULL;
+}
+
+/* 0 and 1 for the rom windows, 2 for the flat tables. nothing cached spans two */
+static inline int
+cpu_code_window(uint16_t adr)
+{
+	return adr < 0x8000 ? adr >> 14 : 2;
+}
+
+/* a scheduled event may have raised an interrupt by now */
+static inline int
+cpu_due(const struct CPU *cpu)
+{
+	return cpu->mcycles >= sched_next(&cpu->sched);
+}
 #endif
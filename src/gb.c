@@ -3,11 +3,16 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <sys/time.h>
+#include "cart.h"
 #include "cpu.h"
 #include "ppu.h"
 #include "gb.h"
+#include "interrupt.h"
 #include "mem.h"
 #include "joypad.h"
+#include "lockstep.h"
+#include "prof.h"
+#include "trace.h"
 
 double
 getmsec() {
@@ -25,15 +30,80 @@ gb_init(void)
 
 	gb->ppu = ppu_init(gb->mem);
 	if (gb->ppu == NULL) return NULL;
+	gb->cpu->ppu = gb->ppu;
 
 	gb->cpu->pc = 0x100;
 
 	gb->running = 1;
-	mem_write(gb->mem, JOYP, 0xcf);
+	gb->mem[JOYP] = 0xcf;
 
 	return gb;
 }
 
+/* the cartridge at path in the slot, 1 if it could not be loaded */
+int
+gb_load(struct GB *gb, const char *path)
+{
+	struct Cart *cart = cart_load(path);
+
+	if (cart == NULL)
+		return 1;
+	cart_insert(cart, gb->cpu);
+	return 0;
+}
+
+/*
+ * a halted cpu only wakes on an interrupt, so jump straight to the mcycle
+ * before the next scheduled event. the joypad follows the host's input, not
+ * the clock, so it never wakes it on its own. returns mcycles skipped
+ */
+int
+gb_fast_forward(struct GB *gb, int max)
+{
+	struct CPU *cpu = gb->cpu;
+
+	if (cpu->ime == IME_NEXT)
+		return 0;
+
+	cpu_catchup(cpu);
+	if (interrupt_pending(cpu->memory))
+		return 0;
+
+	uint64_t event = sched_next(&cpu->sched) - cpu->mcycles;
+	int n = event <= (uint64_t)max ? (int)event - 1 : max;
+	if (n <= 0)
+		return 0;
+
+	cpu->mcycles += n;
+
+	return n;
+}
+
+/* -p or F2, the counts carry on from the last time it was on */
+void
+gb_profile(struct GB *gb, int on)
+{
+	if (gb->prof == NULL && on)
+		gb->prof = prof_init();
+	if (gb->prof != NULL)
+		gb->prof->on = on;
+}
+
+int
+gb_step(struct CPU *cpu)
+{
+	switch (cpu->engine) {
+		case ENGINE_BLOCK:
+			return execute_block(cpu);
+#ifdef JIT
+		case ENGINE_JIT:
+			return execute_jit(cpu);
+#endif
+		default:
+			return execute(cpu);
+	}
+}
+
 void
 gb_run(struct GB *gb)
 {
@@ -42,6 +112,10 @@ gb_run(struct GB *gb)
 	double delta = 0;
 
 	double mcyc_hz = 4194304.0 / 4.0;
+	double synced = time;
+
+	if (gb->lockstep != NULL)
+		lockstep_sync(gb->lockstep, gb->cpu);
 
 	while (gb->running) {
 		delta = getmsec() - time;
@@ -50,8 +124,36 @@ gb_run(struct GB *gb)
 
 		get_input(gb);
 		for (int i = 0; i < cyc; i += cycles) {
-			cycles = execute(gb->cpu);
-			ppu_run(gb->ppu, cycles);
+			uint16_t pc = gb->cpu->pc;
+
+			if (gb->cpu->halt || gb->cpu->stop) {
+				cycles = gb_fast_forward(gb, cyc - i);
+				if (cycles > 0)
+					continue;
+			}
+
+			if (gb->lockstep != NULL) {
+				if ((cycles = lockstep_step(gb->lockstep, gb->cpu, gb_step)) < 0) {
+					gb->running = 0;
+					return;
+				}
+			} else if (gb->prof != NULL && gb->prof->on) {
+				cycles = prof_step(gb->prof, gb->cpu);
+			} else if (gb->trace != NULL) {
+				cycles = trace_step(gb->trace, gb->cpu);
+			} else {
+				cycles = gb_step(gb->cpu);
+			}
+
+			/* branched back, maybe to a copy or polling loop */
+			if (gb->cpu->pc <= pc) {
+				int bulk = bulk_run(&gb->bulk, gb->cpu, cyc - i - cycles);
+				/* the copy went around the cpu, so the shadow memory missed it */
+				if (bulk > 0 && gb->lockstep != NULL)
+					lockstep_sync(gb->lockstep, gb->cpu);
+				cycles += bulk;
+				cycles += idle_skip(&gb->idle, gb->cpu, cyc - i - cycles);
+			}
 		}
 
 
@@ -59,6 +161,8 @@ gb_run(struct GB *gb)
 			continue;
 		}
 
+		/* draw whatever lines are due before showing the frame */
+		cpu_catchup(gb->cpu);
 		SDL_UpdateWindowSurface(gb->ppu->win);
 #ifdef DEBUG
 		debug_draw(gb->ppu);
@@ -68,5 +172,11 @@ gb_run(struct GB *gb)
 #endif /* DEBUG */
 
 		time = getmsec();
+
+		/* battery ram is on disk within seconds, not only at exit */
+		if (gb->cpu->cart != NULL && time - synced > 5000) {
+			cart_sync(gb->cpu->cart);
+			synced = time;
+		}
 	}
 }
@@ -1,8 +1,19 @@
 #include <stdbool.h>
 #include <stdint.h>
+#include "bulk.h"
+#include "idle.h"
+#include "lockstep.h"
+#include "prof.h"
+#include "trace.h"
+
 struct GB {
 	struct CPU *cpu;
 	struct PPU *ppu;
+	struct Idle idle;
+	struct Bulk bulk;
+	struct Lockstep *lockstep; /* NULL unless -l */
+	struct Prof *prof; /* NULL until profiling is first turned on */
+	struct Trace *trace; /* NULL unless -t */
 
 	bool running;
 
@@ -11,4 +22,8 @@ struct GB {
 
 double getmsec();
 struct GB * gb_init(void);
+int gb_load(struct GB *gb, const char *path);
 void gb_run(struct GB *gb);
+int gb_step(struct CPU *cpu);
+int gb_fast_forward(struct GB *gb, int max);
+void gb_profile(struct GB *gb, int on);
@@ -0,0 +1,175 @@
+/*
+ * A loop that only reads memory into a and f reaches the same state every
+ * time it gets back to its head, so until something it can read changes
+ * (a ppu mode change, a timer tick, an interrupt) running it is wasted
+ * work. Whole iterations up to the next such event are skipped and their
+ * cycles left for the timer and ppu to catch up on in one go.
+ */
+#include <limits.h>
+#include <stdint.h>
+
+#include "cpu.h"
+#include "idle.h"
+#include "timer.h"
+
+/* memory read by the instruction at the loop head state, -1 for none */
+static int
+reads(const struct CPU *cpu, uint8_t op, const struct Instr *in)
+{
+	uint16_t hl = cpu->hl;
+
+	switch (op) {
+		case 0x0a: return cpu->bc;
+		case 0x1a: return cpu->de;
+		case 0xf0: return 0xff00 + (in->imm & 0xff);
+		case 0xf2: return 0xff00 + cpu->c;
+		case 0xfa: return in->imm;
+		case 0xcb: return (in->opcode & 7) == 6 ? hl : -1;
+		default: return (op & 0xc7) == 0x46 || (op & 0xc7) == 0x86 ? hl : -1;
+	}
+}
+
+/* no writes to memory, sp or any register but a and f */
+static int
+pure(uint8_t op, const struct Instr *in)
+{
+	if (op == 0xcb) /* bit n, r or anything on a */
+		return (in->opcode & 0xc0) == 0x40 || (in->opcode & 7) == 7;
+	if (op >= 0x78 && op <= 0x7f) /* ld a, r */
+		return 1;
+	if (op >= 0x80 && op <= 0xbf) /* alu a, r */
+		return 1;
+	if ((op & 0xc7) == 0xc6) /* alu a, imm8 */
+		return 1;
+
+	switch (op) {
+		case 0x00: /* nop */
+		case 0x07: case 0x0f: case 0x17: case 0x1f: /* rlca, rrca, rla, rra */
+		case 0x27: case 0x2f: case 0x37: case 0x3f: /* daa, cpl, scf, ccf */
+		case 0x3c: case 0x3d: case 0x3e: /* inc a, dec a, ld a, imm8 */
+		case 0x0a: case 0x1a: /* ld a, [bc] / [de] */
+		case 0xf0: case 0xf2: case 0xfa: /* ldh a, [imm8] / [c], ld a, [imm16] */
+			return 1;
+		default:
+			return 0;
+	}
+}
+
+/* cycles of the closing branch when it is taken back to head, 0 if it is not one */
+static int
+branch(uint16_t adr, uint8_t op, const struct Instr *in, uint16_t head)
+{
+	switch (op) {
+		case 0x18:
+			return (uint16_t)(adr + 2 + (int8_t)in->imm) == head ? in->cycles : 0;
+		case 0x20: case 0x28: case 0x30: case 0x38:
+			return (uint16_t)(adr + 2 + (int8_t)in->imm) == head ? in->cycles + 1 : 0;
+		case 0xc3:
+			return in->imm == head ? in->cycles : 0;
+		case 0xc2: case 0xca: case 0xd2: case 0xda:
+			return in->imm == head ? in->cycles + 1 : 0;
+		default:
+			return 0;
+	}
+}
+
+static void
+analyze(struct Idle *idle, struct CPU *cpu, uint16_t head)
+{
+	uint16_t adr = head;
+	int iter = 0;
+
+	idle->head = head;
+	idle->ok = idle->div = idle->seen = 0;
+
+	for (int i = 0; i < IDLE_MAX; i++) {
+		struct Instr in;
+		uint8_t op = cpu_peek(cpu, adr);
+
+		cpu_decode(cpu, adr, &in);
+
+		int taken = branch(adr, op, &in, head);
+		if (taken) {
+			idle->ok = 1;
+			idle->iter = iter + taken;
+			return;
+		}
+
+		if (!pure(op, &in))
+			return;
+
+		/* b..l never change inside the loop so the address is fixed */
+		if (reads(cpu, op, &in) == DIV)
+			idle->div = 1;
+
+		iter += in.cycles;
+		adr += in.len;
+	}
+}
+
+static void
+snapshot(struct Idle *idle, struct CPU *cpu)
+{
+	uint8_t regs[8] = { cpu->a, cpu->f.flags, cpu->b, cpu->c, cpu->d, cpu->e, cpu->h, cpu->l };
+
+	for (int i = 0; i < 8; i++)
+		idle->regs[i] = regs[i];
+	idle->sp = cpu->sp;
+	idle->mcycles = cpu->mcycles;
+	idle->interrupts = cpu->interrupts;
+	idle->seen = 1;
+}
+
+static int
+same(const struct Idle *idle, const struct CPU *cpu)
+{
+	uint8_t regs[8] = { cpu->a, cpu->f.flags, cpu->b, cpu->c, cpu->d, cpu->e, cpu->h, cpu->l };
+
+	for (int i = 0; i < 8; i++)
+		if (idle->regs[i] != regs[i])
+			return 0;
+
+	return idle->sp == cpu->sp && idle->interrupts == cpu->interrupts;
+}
+
+/*
+ * called when the cpu branched back to pc, returns the mcycles skipped
+ * (at most max), which the timer and ppu catch up on later
+ */
+int
+idle_skip(struct Idle *idle, struct CPU *cpu, int max)
+{
+	if (cpu->pc != idle->head)
+		analyze(idle, cpu, cpu->pc);
+
+	if (!idle->ok || cpu->halt || cpu->ime == IME_NEXT)
+		return 0;
+
+	cpu_sync_flags(cpu);
+
+	/* a whole number of clean iterations since the last arrival, same state */
+	uint64_t since = cpu->mcycles - idle->mcycles;
+	if (!idle->seen || !same(idle, cpu) || since == 0 || since % idle->iter) {
+		snapshot(idle, cpu);
+		return 0;
+	}
+
+	/* skipping n mcycles is safe while n < next */
+	cpu_catchup(cpu);
+	int next = timer_next_event(cpu, idle->div);
+	uint64_t event = sched_next(&cpu->sched) - cpu->mcycles;
+	if (event < (uint64_t)next)
+		next = event;
+	if (max < next)
+		next = max + 1;
+
+	int n = (next - 1) / idle->iter * idle->iter;
+	if (n <= 0)
+		return 0;
+
+	cpu->mcycles += n;
+	idle->mcycles = cpu->mcycles;
+	idle->skipped += n;
+
+	return n;
+}
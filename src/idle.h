@@ -0,0 +1,25 @@
+#ifndef IDLE_H
+#define IDLE_H
+#include <stdint.h>
+#include "cpu.h"
+
+#define IDLE_MAX 8 /* instructions in a polling loop */
+
+/* the polling loop the cpu last branched back to */
+struct Idle {
+	uint16_t head;
+	uint8_t ok; /* side effect free, only a and f change */
+	uint8_t div; /* reads DIV, so its ticks count as events */
+	uint8_t iter; /* mcycles per iteration */
+	uint8_t seen; /* regs hold the state of the last arrival */
+
+	uint8_t regs[8];
+	uint16_t sp;
+	uint64_t mcycles;
+	uint32_t interrupts;
+
+	uint64_t skipped; /* guest mcycles fast-forwarded */
+};
+
+int idle_skip(struct Idle *idle, struct CPU *cpu, int max);
+#endif /* IDLE_H */
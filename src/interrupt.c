@@ -0,0 +1,24 @@
+#include <stdint.h>
+
+#include "interrupt.h"
+
+void
+interrupt_request(uint8_t *mem, enum INTERRUPT interrupt)
+{
+	mem[IF] |= interrupt;
+}
+
+/* clears the highest priority pending source, returns its vector or 0 */
+uint16_t
+interrupt_ack(uint8_t *mem)
+{
+	uint8_t pending = interrupt_pending(mem);
+
+	if (pending == 0)
+		return 0;
+
+	int n = __builtin_ctz(pending);
+	mem[IF] &= ~(1 << n);
+
+	return 0x40 + n * 8;
+}
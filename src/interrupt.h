@@ -0,0 +1,18 @@
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+#include <stdint.h>
+#include "cpu.h"
+#include "mem.h"
+
+#define INTERRUPT_MASK 0x1f
+
+void interrupt_request(uint8_t *mem, enum INTERRUPT interrupt);
+uint16_t interrupt_ack(uint8_t *mem);
+
+/* enabled and requested sources, lowest bit has priority */
+static inline uint8_t
+interrupt_pending(const uint8_t *mem)
+{
+	return mem[IE] & mem[IF] & INTERRUPT_MASK;
+}
+#endif /* INTERRUPT_H */
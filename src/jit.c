@@ -0,0 +1,431 @@
+/*
+ * x86-64 translation of hot blocks.
+ *
+ * The translation is call threaded only, nothing is done natively: each
+ * instruction becomes a direct call of its handler with a copy of the decoded
+ * instruction, followed by adding its cycles to cpu->mcycles, so every cycle is
+ * charged exactly as in the interpreter. Blocks chain through the pc-indexed
+ * tables (the flat one or the mapped rom bank's) while no interrupt is pending and
+ * the chain budget lasts; invalidation only has to clear a table slot.
+ *
+ * rbx holds the cpu and r12d the cycles run since entry. The cache is never
+ * writable and executable at once, the pages a block goes to are made writable
+ * while it is emitted, which only happens outside translated code.
+ */
+#define _DEFAULT_SOURCE /* MAP_ANONYMOUS */
+
+#if !defined(__x86_64__)
+#error "the jit only targets x86-64"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "block.h"
+#include "cpu.h"
+#include "interrupt.h"
+#include "jit.h"
+#include "mem.h"
+
+/* bytes emitted per instruction and per block, upper bounds */
+#define INSTR_CODE 96
+#define BLOCK_CODE 128
+
+struct JitBlock {
+	void *code;
+	uint16_t pc, end;
+};
+
+struct Jit {
+	struct JitBlock *table[1 << 16]; /* outside the rom banks, see jit_at */
+	uint8_t heat[1 << 16]; /* same, see heat_at */
+	int (*enter)(struct CPU *cpu, void *code);
+	uint8_t *exit;
+	uint8_t *cache, *base, *top;
+	uintptr_t page; /* size, for mprotect */
+	uint8_t running; /* inside translated code */
+};
+
+static void
+emit8(struct Jit *jit, uint8_t b)
+{
+	*jit->top++ = b;
+}
+
+static void
+emit(struct Jit *jit, const uint8_t *bytes, size_t n)
+{
+	memcpy(jit->top, bytes, n);
+	jit->top += n;
+}
+
+static void
+emit16(struct Jit *jit, uint16_t v)
+{
+	emit(jit, (uint8_t *)&v, 2);
+}
+
+static void
+emit32(struct Jit *jit, uint32_t v)
+{
+	emit(jit, (uint8_t *)&v, 4);
+}
+
+static void
+emit64(struct Jit *jit, uint64_t v)
+{
+	emit(jit, (uint8_t *)&v, 8);
+}
+
+/* jcc/jmp rel32 to target, op is the opcode bytes */
+static void
+emit_jump(struct Jit *jit, const uint8_t *op, size_t n, const uint8_t *target)
+{
+	emit(jit, op, n);
+	emit32(jit, target - (jit->top + 4));
+}
+
+/* mov rax, fn; call rax */
+static void
+emit_call(struct Jit *jit, uintptr_t fn)
+{
+	emit(jit, (uint8_t[]){0x48, 0xb8}, 2);
+	emit64(jit, fn);
+	emit(jit, (uint8_t[]){0xff, 0xd0}, 2);
+}
+
+/* mov rdi, rbx */
+static void
+emit_arg_cpu(struct Jit *jit)
+{
+	emit(jit, (uint8_t[]){0x48, 0x89, 0xdf}, 3);
+}
+
+static void
+emit_stubs(struct Jit *jit)
+{
+	jit->enter = (int (*)(struct CPU *, void *))(uintptr_t)jit->top;
+	emit(jit, (uint8_t[]){
+		0x53,                   /* push rbx */
+		0x41, 0x54,             /* push r12 */
+		0x41, 0x55,             /* push r13 */
+		0x48, 0x89, 0xfb,       /* mov rbx, rdi */
+		0x45, 0x31, 0xe4,       /* xor r12d, r12d */
+		0xc6, 0x83,             /* mov byte [rbx + smc], 0 */
+	}, 13);
+	emit32(jit, offsetof(struct CPU, smc));
+	emit8(jit, 0x00);
+	emit(jit, (uint8_t[]){0xff, 0xe6}, 2); /* jmp rsi */
+
+	jit->exit = jit->top;
+	emit(jit, (uint8_t[]){
+		0x44, 0x89, 0xe0,       /* mov eax, r12d */
+		0x41, 0x5d,             /* pop r13 */
+		0x41, 0x5c,             /* pop r12 */
+		0x5b,                   /* pop rbx */
+		0xc3,                   /* ret */
+	}, 9);
+
+	jit->base = jit->top;
+}
+
+/* sets prot on the pages covering [start, end) */
+static void
+protect(struct Jit *jit, const uint8_t *start, const uint8_t *end, int prot)
+{
+	uintptr_t lo = (uintptr_t)start & ~(jit->page - 1);
+	uintptr_t hi = ((uintptr_t)end + jit->page - 1) & ~(jit->page - 1);
+
+	if (mprotect((void *)lo, hi - lo, prot) != 0) {
+		perror("jit mprotect");
+		exit(1);
+	}
+}
+
+struct Jit *
+jit_init(void)
+{
+	struct Jit *jit = calloc(1, sizeof(struct Jit));
+	if (jit == NULL)
+		return NULL;
+
+	jit->page = sysconf(_SC_PAGESIZE);
+	jit->cache = mmap(NULL, JIT_CACHE, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (jit->cache == MAP_FAILED) {
+		free(jit);
+		return NULL;
+	}
+
+	jit->top = jit->cache;
+	emit_stubs(jit);
+	protect(jit, jit->cache, jit->top, PROT_READ | PROT_EXEC);
+
+	return jit;
+}
+
+void
+jit_free(struct Jit *jit)
+{
+	if (jit == NULL)
+		return;
+	munmap(jit->cache, JIT_CACHE);
+	free(jit);
+}
+
+/* where the translation of the block at pc is kept */
+static struct JitBlock **
+jit_at(struct CPU *cpu, uint16_t pc)
+{
+	struct BankCode *bc = cpu_bank_code(cpu, pc);
+
+	return bc != NULL ? &bc->jit[pc % ROM_BANK] : &cpu->jit->table[pc];
+}
+
+/* how often the block at pc ran untranslated, kept next to jit_at's slot */
+static uint8_t *
+heat_at(struct CPU *cpu, uint16_t pc)
+{
+	struct BankCode *bc = cpu_bank_code(cpu, pc);
+
+	return bc != NULL ? &bc->heat[pc % ROM_BANK] : &cpu->jit->heat[pc];
+}
+
+/* nonzero when the chain has to return to execute_jit */
+static int
+must_return(struct CPU *cpu)
+{
+	if (cpu->halt || cpu->stop || cpu->halt_bug || cpu->ime == IME_NEXT)
+		return 1;
+
+	if (cpu_due(cpu))
+		cpu_catchup(cpu);
+
+	return cpu->ime == IME_SET
+		&& interrupt_pending(cpu->memory);
+}
+
+/* the code to chain to at the end of a block, NULL to return to execute_jit */
+static void *
+chain(struct CPU *cpu)
+{
+	if (must_return(cpu))
+		return NULL;
+
+	struct JitBlock *jb = *jit_at(cpu, cpu->pc);
+	return jb != NULL ? jb->code : NULL;
+}
+
+/* rom in a bank's tables is never written, so only the rest is counted */
+static void
+mark(struct CPU *cpu, const struct JitBlock *jb, int n)
+{
+	for (uint16_t adr = jb->pc; adr != jb->end; adr++)
+		if (cpu_bank_code(cpu, adr) == NULL)
+			cpu->code[adr] += n;
+}
+
+static struct JitBlock *
+translate(struct Jit *jit, const struct Block *blk, int timed)
+{
+	/* copies of the instructions live next to the code, the block may be freed */
+	jit->top = (uint8_t *)(((uintptr_t)jit->top + 15) & ~(uintptr_t)15);
+	struct Instr *instr = (struct Instr *)jit->top;
+	memcpy(instr, blk->instr, blk->len * sizeof(struct Instr));
+	jit->top += blk->len * sizeof(struct Instr);
+
+	struct JitBlock *jb = (struct JitBlock *)jit->top;
+	jit->top += sizeof(struct JitBlock);
+	jb->pc = blk->pc;
+	jb->end = blk->end;
+	jb->code = jit->top;
+
+	uint16_t pc = blk->pc;
+	for (int i = 0; i < blk->len; i++) {
+		const struct Instr *in = &instr[i];
+		pc += in->len;
+
+		/* mov word [rbx + pc], next pc */
+		emit(jit, (uint8_t[]){0x66, 0xc7, 0x83}, 3);
+		emit32(jit, offsetof(struct CPU, pc));
+		emit16(jit, pc);
+
+		/* fn(cpu, in) */
+		emit_arg_cpu(jit);
+		emit(jit, (uint8_t[]){0x48, 0xbe}, 2); /* mov rsi, in */
+		emit64(jit, (uintptr_t)in);
+#ifdef OPSTATS
+		emit_call(jit, (uintptr_t)cpu_call);
+#else
+		emit_call(jit, (uintptr_t)in->fn);
+#endif
+
+		/* branches and fused instructions vary, keep what it returned */
+		emit(jit, (uint8_t[]){0x41, 0x89, 0xc5}, 3); /* mov r13d, eax */
+		emit(jit, (uint8_t[]){0x45, 0x01, 0xec}, 3); /* add r12d, r13d */
+
+		if (timed) {
+			/* add qword [rbx + mcycles], r13 */
+			emit(jit, (uint8_t[]){0x4c, 0x01, 0xab}, 3);
+			emit32(jit, offsetof(struct CPU, mcycles));
+		}
+
+		/* cmp byte [rbx + smc], 0; jne exit */
+		emit(jit, (uint8_t[]){0x80, 0xbb}, 2);
+		emit32(jit, offsetof(struct CPU, smc));
+		emit8(jit, 0x00);
+		emit_jump(jit, (uint8_t[]){0x0f, 0x85}, 2, jit->exit);
+	}
+
+	if (!timed) {
+		emit_jump(jit, (uint8_t[]){0xe9}, 1, jit->exit);
+		return jb;
+	}
+
+	/* cmp r12d, JIT_CHAIN; jae exit */
+	emit(jit, (uint8_t[]){0x41, 0x81, 0xfc}, 3);
+	emit32(jit, JIT_CHAIN);
+	emit_jump(jit, (uint8_t[]){0x0f, 0x83}, 2, jit->exit);
+
+	/* chain(cpu); test rax, rax; jz exit; jmp rax */
+	emit_arg_cpu(jit);
+	emit_call(jit, (uintptr_t)chain);
+	emit(jit, (uint8_t[]){0x48, 0x85, 0xc0}, 3);
+	emit_jump(jit, (uint8_t[]){0x0f, 0x84}, 2, jit->exit);
+	emit(jit, (uint8_t[]){0xff, 0xe0}, 2);
+
+	return jb;
+}
+
+static size_t
+code_size(const struct Block *blk)
+{
+	return 16 + blk->len * (sizeof(struct Instr) + INSTR_CODE)
+		+ sizeof(struct JitBlock) + BLOCK_CODE;
+}
+
+/* translates blk at top, its pages are only writable until it is done */
+static struct JitBlock *
+emit_block(struct Jit *jit, const struct Block *blk, int timed)
+{
+	uint8_t *start = jit->top;
+
+	protect(jit, start, start + code_size(blk), PROT_READ | PROT_WRITE);
+	struct JitBlock *jb = translate(jit, blk, timed);
+	protect(jit, start, jit->top, PROT_READ | PROT_EXEC);
+
+	return jb;
+}
+
+/* single instructions for the sm83 tests, untimed like cpu_execute, in the cpu's own cache */
+static int
+run_once(struct CPU *cpu)
+{
+	if (cpu->jit == NULL && (cpu->jit = jit_init()) == NULL)
+		return cpu_execute(cpu);
+
+	struct Jit *jit = cpu->jit;
+	struct Block *blk = block_build(cpu, cpu->pc, 1);
+	if (blk == NULL)
+		return cpu_execute(cpu);
+	jit->top = jit->base;
+	struct JitBlock *jb = emit_block(jit, blk, 0);
+	free(blk);
+
+	return jit->enter(cpu, jb->code);
+}
+
+static int
+enter(struct Jit *jit, struct CPU *cpu, const struct JitBlock *jb)
+{
+	jit->running = 1;
+	int cycles = jit->enter(cpu, jb->code);
+	jit->running = 0;
+
+	return cycles;
+}
+
+int
+cpu_execute_jit(struct CPU *cpu)
+{
+	struct Jit *jit = cpu->jit;
+	uint16_t pc = cpu->pc;
+
+	if (jit == NULL || cpu->blocks == NULL)
+		return run_once(cpu);
+
+	struct JitBlock *jb = *jit_at(cpu, pc);
+	if (jb != NULL)
+		return enter(jit, cpu, jb);
+
+	struct Block *blk = *block_at(cpu, pc);
+	uint8_t *heat = heat_at(cpu, pc);
+	if (blk == NULL || *heat < JIT_HOT || !cpu_cacheable(pc)) {
+		if (*heat < JIT_HOT)
+			(*heat)++;
+		return cpu_execute_block(cpu, BLOCK_MAX);
+	}
+
+	if ((size_t)(jit->cache + JIT_CACHE - jit->top) < code_size(blk))
+		jit_flush(cpu);
+
+	jb = emit_block(jit, blk, 1);
+	*jit_at(cpu, pc) = jb;
+	mark(cpu, jb, 1);
+
+	return enter(jit, cpu, jb);
+}
+
+void
+jit_invalidate(struct CPU *cpu, uint16_t adr)
+{
+	struct Jit *jit = cpu->jit;
+
+	for (int i = 0; i < BLOCK_MAX * 3; i++) {
+		uint16_t pc = adr - i;
+		struct JitBlock *jb = *jit_at(cpu, pc);
+
+		if (jb == NULL || (uint16_t)(adr - jb->pc) >= (uint16_t)(jb->end - jb->pc))
+			continue;
+
+		mark(cpu, jb, -1);
+		*jit_at(cpu, pc) = NULL;
+		*heat_at(cpu, pc) = 0;
+
+		/* the code stays mapped, running code just stops after this instruction */
+		if (jit->running)
+			cpu->smc |= SMC_WRITTEN;
+	}
+}
+
+static void
+flush(struct CPU *cpu, struct JitBlock **table, uint8_t *heat, int n)
+{
+	for (int i = 0; i < n; i++) {
+		if (table[i] == NULL)
+			continue;
+		mark(cpu, table[i], -1);
+		table[i] = NULL;
+	}
+	memset(heat, 0, n);
+}
+
+/* drops every translation, only called outside translated code */
+void
+jit_flush(struct CPU *cpu)
+{
+	struct Jit *jit = cpu->jit;
+
+	flush(cpu, jit->table, jit->heat, 1 << 16);
+	for (int i = 0; i < 2 * ROM_BANKS_MAX; i++) {
+		struct BankCode *bc = cpu->bank_code[i];
+		if (bc != NULL)
+			flush(cpu, bc->jit, bc->heat, ROM_BANK);
+	}
+	jit->top = jit->base;
+}
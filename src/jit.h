@@ -0,0 +1,12 @@
+#include <stdint.h>
+#include "cpu.h"
+
+#define JIT_CACHE (8 << 20)
+#define JIT_HOT 16   /* runs through the block engine before translation */
+#define JIT_CHAIN 64 /* mcycles chained blocks may run before returning */
+
+struct Jit *jit_init(void);
+void jit_free(struct Jit *jit);
+int cpu_execute_jit(struct CPU *cpu);
+void jit_invalidate(struct CPU *cpu, uint16_t adr);
+void jit_flush(struct CPU *cpu);
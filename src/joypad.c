@@ -3,6 +3,7 @@
 #include <stdint.h>
 #include "mem.h"
 #include "gb.h"
+#include "interrupt.h"
 #include "joypad.h"
 static uint8_t buttons = ~0;
 static uint8_t dpad = ~0;
@@ -28,6 +29,8 @@ get_input(struct GB *gb)
 	SDL_Event e;
 	SDL_PollEvent(&e);
 
+	uint16_t held = buttons << 8 | dpad;
+
 	switch (e.type) {
 		case SDL_KEYDOWN:
 		{
@@ -35,6 +38,9 @@ get_input(struct GB *gb)
 					case SDLK_ESCAPE:
 						gb->running = 0;
 						break;
+					case SDLK_F2:
+						gb_profile(gb, gb->prof == NULL || !gb->prof->on);
+						break;
 					case SDLK_RETURN:
 						buttons &= ~BUTTON_START;
 						break;
@@ -61,6 +67,10 @@ get_input(struct GB *gb)
 						dpad &= ~DPAD_RIGHT;
 					break;
 				}
+
+				/* a line went low, it comes from the host so it is never scheduled */
+				if ((buttons << 8 | dpad) != held)
+					interrupt_request(gb->mem, INTERRUPT_JOYPAD);
 				break;
 		}
 		case SDL_KEYUP:
@@ -1,4 +1,7 @@
 #include <stdint.h>
+
+struct GB;
+
 enum {
 	JOYP = 0xff00,
 };
@@ -0,0 +1,240 @@
+/*
+ * Lockstep runs every step of an optimized engine a second time with plain
+ * cpu_execute on cloned state and stops at the first difference. Memory and
+ * the cartridge of the reference are copied once on a sync and from then on
+ * kept equal by the writes both sides make. Before each step it gets the
+ * fast cpu's registers and timer, and the few io registers and oam that the
+ * ppu, timer, serial, dma and joypad change behind the cpu's back, so the
+ * cost is one interpreted step plus comparing what either side wrote.
+ *
+ * The ppu is left out of the step on both sides: what it does in the middle
+ * of an instruction or block is never checked, only its registers as they
+ * are when the step starts.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu.h"
+#include "joypad.h"
+#include "lockstep.h"
+#include "mem.h"
+#include "opcode.h"
+#include "ppu.h"
+#include "timer.h"
+
+struct Lockstep *
+lockstep_init(int timed, FILE *out)
+{
+	struct Lockstep *ls = calloc(1, sizeof(struct Lockstep));
+	if (ls == NULL)
+		return NULL;
+
+	ls->timed = timed;
+	ls->out = out;
+	mem_mute(ls->mem);
+	cpu_map(&ls->bus, ls->mem);
+
+	return ls;
+}
+
+/*
+ * the reference gets a cartridge of its own with a copy of the ram, its mbc
+ * writes then remap its bus and not the fast cpu's. nothing it does reaches
+ * the .sav file
+ */
+static void
+clone_cart(struct Lockstep *ls, const struct Cart *cart)
+{
+	ls->cart = *cart;
+	ls->cart.sav = NULL;
+	ls->cart.sav_size = 0;
+	ls->cart.saved = 0;
+	ls->cart.rtc.footer = NULL; /* the clock keeps its registers, not the file's */
+	if (cart->ram != NULL) {
+		memcpy(ls->ram, cart->ram, cart->ram_size);
+		ls->cart.ram = ls->ram;
+	}
+
+	ls->ref.memory = ls->mem;
+	ls->ref.bus = &ls->bus;
+	cart_insert(&ls->cart, &ls->ref);
+}
+
+/* full copy of memory and the cartridge, before the first step or after anything bypassed the cpu */
+void
+lockstep_sync(struct Lockstep *ls, const struct CPU *cpu)
+{
+	memcpy(ls->mem, cpu->memory, sizeof(ls->mem));
+	if (cpu->cart != NULL)
+		clone_cart(ls, cpu->cart);
+}
+
+/* io registers written around write8, by the ppu, timer, serial and joypad */
+static const uint16_t outside[] = { JOYP, SB, SC, DIV, TIMA, IF, STAT, LY };
+
+static void
+clone(struct Lockstep *ls, const struct CPU *cpu)
+{
+	for (size_t i = 0; i < sizeof(outside) / sizeof(outside[0]); i++)
+		ls->mem[outside[i]] = cpu->memory[outside[i]];
+
+	ls->ref = *cpu;
+	ls->ref.memory = ls->mem;
+	ls->ref.bus = &ls->bus;
+	ls->ref.cart = cpu->cart != NULL ? &ls->cart : NULL;
+	ls->ref.icache = NULL;
+	ls->ref.blocks = NULL;
+	ls->ref.rom_code[0] = ls->ref.rom_code[1] = NULL;
+	ls->ref.bank_code = NULL;
+	ls->ref.code = NULL;
+	ls->ref.cur_block = NULL;
+	ls->ref.jit = NULL;
+	ls->ref.engine = ENGINE_INTERP;
+	ls->ref.writes = &ls->slow;
+	ls->ref.ppu = NULL;
+	ls->ref.opstats = NULL;
+
+	ls->fast.n = 0;
+	ls->slow.n = 0;
+}
+
+/* the contract every engine keeps: instructions one at a time, interrupts after */
+static void
+reference(struct Lockstep *ls, int cycles)
+{
+	struct CPU *ref = &ls->ref;
+	int run = 0;
+
+	if (ref->ime == IME_NEXT)
+		ref->ime = IME_SET;
+
+	do {
+		int c = cpu_execute(ref);
+		run += c;
+		if (ls->timed)
+			ref->mcycles += c;
+	} while (run < cycles);
+
+	if (ls->timed)
+		check_interrupts(ref);
+}
+
+#define DIFF(name, fmt, x, y) \
+	if ((x) != (y)) \
+		fprintf(ls->out, "  %-8s " fmt " != " fmt "\n", name, x, y), diff++;
+
+static int
+compare_mem(struct Lockstep *ls, const struct CPU *cpu, uint16_t adr)
+{
+	uint8_t x = cpu_peek(cpu, adr), y = cpu_peek(&ls->ref, adr);
+
+	if (x == y)
+		return 0;
+
+	fprintf(ls->out, "  [%04x]   %02x != %02x\n", adr, x, y);
+	return 1;
+}
+
+static int
+compare(struct Lockstep *ls, struct CPU *cpu)
+{
+	struct CPU *ref = &ls->ref;
+	int diff = 0;
+
+	cpu_sync_flags(cpu);
+	cpu_sync_flags(ref);
+
+	/* either side may have left its timer behind, bring both up to date */
+	if (ls->timed) {
+		timer_catchup(cpu);
+		timer_catchup(ref);
+	}
+
+	DIFF("pc", "%04x", cpu->pc, ref->pc)
+	DIFF("sp", "%04x", cpu->sp, ref->sp)
+	DIFF("af", "%04x", cpu->af, ref->af)
+	DIFF("bc", "%04x", cpu->bc, ref->bc)
+	DIFF("de", "%04x", cpu->de, ref->de)
+	DIFF("hl", "%04x", cpu->hl, ref->hl)
+	DIFF("ime", "%d", cpu->ime, ref->ime)
+	DIFF("halt", "%d", cpu->halt, ref->halt)
+	DIFF("stop", "%d", cpu->stop, ref->stop)
+	DIFF("halt_bug", "%d", cpu->halt_bug, ref->halt_bug)
+	DIFF("mcycles", "%llu", (unsigned long long)cpu->mcycles, (unsigned long long)ref->mcycles)
+	DIFF("div", "%04x", cpu->div, ref->div)
+	if (cpu->cart != NULL) {
+		DIFF("rom_bank", "%x", cpu->cart->rom_bank, ref->cart->rom_bank)
+		DIFF("ram_bank", "%x", cpu->cart->ram_bank, ref->cart->ram_bank)
+		DIFF("ram_on", "%d", cpu->cart->ram_on, ref->cart->ram_on)
+		DIFF("mode", "%d", cpu->cart->mode, ref->cart->mode)
+	}
+
+	/* a log that filled up may have missed writes, look at everything */
+	if (ls->fast.n == WRITES_MAX || ls->slow.n == WRITES_MAX) {
+		for (int adr = 0; adr < 1 << 16; adr++)
+			diff += compare_mem(ls, cpu, adr);
+		return diff;
+	}
+
+	for (int i = 0; i < ls->fast.n; i++)
+		diff += compare_mem(ls, cpu, ls->fast.adr[i]);
+	for (int i = 0; i < ls->slow.n; i++)
+		diff += compare_mem(ls, cpu, ls->slow.adr[i]);
+
+	/* the timer writes around write8 */
+	diff += compare_mem(ls, cpu, IF);
+	diff += compare_mem(ls, cpu, DIV);
+	diff += compare_mem(ls, cpu, TIMA);
+
+	return diff;
+}
+
+/*
+ * runs step on cpu and the reference on its clone, returns the cycles step
+ * took or -1 after printing the differences (fast != reference)
+ */
+int
+lockstep_step(struct Lockstep *ls, struct CPU *cpu, int (*step)(struct CPU *cpu))
+{
+	uint16_t pc = cpu->pc;
+
+	/*
+	 * the reference has no ppu, so the fast cpu leaves it alone for the
+	 * step too. both start with the io registers as it left them
+	 */
+	struct PPU *ppu = cpu->ppu;
+	cpu_catchup(cpu);
+	clone(ls, cpu);
+
+	/* a dma pending after the last step was done by the fast cpu alone */
+	if (ls->dma && cpu->sched.pos[EVENT_DMA] == 0)
+		memcpy(&ls->mem[OAM], &cpu->memory[OAM], 0xa0);
+
+	struct Writes *writes = cpu->writes;
+	cpu->writes = &ls->fast;
+	cpu->ppu = NULL;
+	int cycles = step(cpu);
+	cpu->ppu = ppu;
+	cpu->writes = writes;
+
+	reference(ls, cycles);
+	ls->steps++;
+	ls->dma = cpu->sched.pos[EVENT_DMA] != 0;
+
+	if (compare(ls, cpu) == 0)
+		return cycles;
+
+	uint8_t op[3] = {
+		cpu_peek(cpu, pc),
+		cpu_peek(cpu, pc + 1),
+		cpu_peek(cpu, pc + 2),
+	};
+	char *mnemonic = get_mnemonic(op);
+	fprintf(ls->out, "lockstep: step %llu from %04x (%s) diverged, fast != reference\n",
+		(unsigned long long)ls->steps, pc, mnemonic);
+	free(mnemonic);
+
+	return -1;
+}
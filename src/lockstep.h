@@ -0,0 +1,26 @@
+#ifndef LOCKSTEP_H
+#define LOCKSTEP_H
+#include <stdint.h>
+#include <stdio.h>
+#include "cart.h"
+#include "cpu.h"
+
+/* the plain interpreter shadowing a faster engine on a copy of memory */
+struct Lockstep {
+	struct CPU ref;
+	struct Writes fast, slow;
+	int timed; /* steps advance the timer and take interrupts, like execute() */
+	int dma; /* the fast cpu had one pending after the last step */
+	uint64_t steps;
+	FILE *out;
+
+	struct Bus bus; /* the reference's, over mem and cart */
+	uint8_t mem[1 << 16];
+	struct Cart cart; /* the reference's, only the rom is shared */
+	uint8_t ram[RAM_BANKS_MAX * RAM_BANK];
+};
+
+struct Lockstep *lockstep_init(int timed, FILE *out);
+void lockstep_sync(struct Lockstep *ls, const struct CPU *cpu);
+int lockstep_step(struct Lockstep *ls, struct CPU *cpu, int (*step)(struct CPU *cpu));
+#endif /* LOCKSTEP_H */
@@ -1,11 +1,14 @@
+#define _POSIX_C_SOURCE 200809L
 #include <stdbool.h>
 #include <sys/types.h>
+#include <unistd.h>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_error.h>
 #include <SDL2/SDL_events.h>
 #include <SDL2/SDL_surface.h>
 #include <SDL2/SDL_video.h>
 
+#include "cart.h"
 #include "cpu.h"
 #include "mem.h"
 #include "opcode.h"
@@ -20,15 +23,66 @@ main(int argc, char **argv) {
 
 	if (gb == NULL) return 1;
 
-	if (argc < 2) {
-		fprintf(stderr, "usage: gbem <gb file>\n");
+	int opt, deterministic = 0;
+	while ((opt = getopt(argc, argv, "de:lpt:")) != -1) {
+		switch (opt) {
+			case 'd':
+				deterministic = 1;
+				break;
+			case 'e':
+				if ((gb->cpu->engine = cpu_engine(optarg)) < 0) {
+					fprintf(stderr, "unknown engine %s\n", optarg);
+					return 1;
+				}
+				break;
+			case 'l':
+				if ((gb->lockstep = lockstep_init(1, stderr)) == NULL)
+					return 1;
+				break;
+			case 'p':
+				gb_profile(gb, 1);
+				break;
+			case 't':
+				if ((gb->trace = trace_open(optarg)) == NULL)
+					return 1;
+				break;
+			default:
+				goto usage;
+		}
+	}
+
+	if (optind >= argc) {
+usage:
+		fprintf(stderr, "usage: gbem [-d] [-e interp|block|jit] [-l] [-p] [-t trace] <gb file>\n");
 		return 1;
 	}
 
-	if (load_rom(gb->mem, argv[1])) {
+	if (gb_load(gb, argv[optind])) {
 		return 1;
 	}
+	if (deterministic)
+		cart_deterministic(gb->cpu->cart);
 
 	gb_run(gb);
+
+	fprintf(stderr, "idle loops: skipped %llu of %llu mcycles\n",
+		 (unsigned long long)gb->idle.skipped, (unsigned long long)gb->cpu->mcycles);
+	fprintf(stderr, "copy loops: %llu bytes in %llu mcycles\n",
+		 (unsigned long long)gb->bulk.bytes, (unsigned long long)gb->bulk.mcycles);
+#ifdef FUSE
+	cpu_fuse_stats(gb->cpu, stderr);
+#endif
+#ifdef OPSTATS
+	FILE *csv = fopen("opstats.csv", "w");
+	if (csv != NULL) {
+		cpu_opstats(gb->cpu, csv);
+		fclose(csv);
+	}
+#endif
+	if (gb->prof != NULL)
+		prof_report(gb->prof, gb->cpu, stderr, 20);
+	if (gb->trace != NULL)
+		trace_close(gb->trace);
+	cart_free(gb->cpu->cart);
 	return 0;
 }
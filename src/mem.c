@@ -5,71 +5,34 @@
 #include <string.h>
 #include "cpu.h"
 #include "mem.h"
-#include "timer.h"
-#include "joypad.h"
 
 static FILE *f = NULL;
+static const uint8_t *muted = NULL;
 
+/* serial output written to mem is dropped, for shadow copies of memory */
 void
-mem_init(struct CPU *cpu)
-{
-	memset(cpu->memory, 0, 0xFFFF + 1);
-}
-
-int
-load_rom(uint8_t *mem, char *path)
+mem_mute(const uint8_t *mem)
 {
-	FILE* file = fopen(path, "rb");
-	if (file == NULL) {
-		fprintf(stderr, "unable to open rom: %s\n", path);
-		return 1;
-	}
-
-	int pos = 0;
-	while (fread(&mem[pos], 1, 1, file)) {
-		pos++;
-	}
-	fclose(file);
-
-	return 0;
+	muted = mem;
 }
 
 void
-request_interrupt(uint8_t *mem, enum INTERRUPT interrupt)
+mem_init(struct CPU *cpu)
 {
-	mem_write(mem, IF, interrupt);
-}
-
-
-uint8_t
-mem_read(uint8_t *mem, uint16_t adr) {
-#ifndef TEST
-	if (adr == JOYP)
-		return read_input(mem[JOYP]);
-#endif
-	return mem[adr];
+	memset(cpu->memory, 0, 0xFFFF + 1);
 }
 
+/* a byte sent on the serial port, test roms print their results this way */
 void
-mem_write(uint8_t *mem, uint16_t adr, uint8_t data) {
-#ifndef TEST
-	if (adr < 0x8000)
+mem_serial(const uint8_t *mem)
+{
+	if (mem == muted)
 		return;
-#endif
-
-	if (adr == SC && data == 0x81) {
-		f = fopen("/tmp/log", "a");
-		if (f == NULL)
-			exit(5);
-
-		fprintf(f, "%c", mem_read(mem, SB));
-		fclose(f);
-	}
 
-#ifndef TEST
-	if (adr == DIV)
-		data = 0x00;
-#endif
+	f = fopen("/tmp/log", "a");
+	if (f == NULL)
+		exit(5);
 
-	mem[adr] = data;
+	fprintf(f, "%c", mem[SB]);
+	fclose(f);
 }
@@ -1,9 +1,11 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_video.h>
 #include <assert.h>
+#include <limits.h>
 #include <stdint.h>
 #include <stdint.h>
 #include "cpu.h"
+#include "interrupt.h"
 #include "ppu.h"
 #include "mem.h"
 #include "gb.h"
@@ -81,7 +83,7 @@ debug_bg(struct PPU *ppu)
 
 	for (int i = 0; i < WINDOW_HEIGHT_TILES; i++) {
 		for (int j = 0; j < WINDOW_WIDTH_TILES; j++) {
-			uint8_t id = mem_read(ppu->mem, adr + i * WINDOW_WIDTH_TILES + j);
+			uint8_t id = ppu->mem[adr + i * WINDOW_WIDTH_TILES + j];
 			uint8_t **tile = get_tile(ppu, id);
 			draw_tile(ppu, ppu->debug_bgfb, tile, j * 8, i * 8);
 			for (int k = 0; k < 8; k++)
@@ -99,7 +101,7 @@ debug_win(struct PPU *ppu)
 	if (lcdc.w_tmap) adr = 0x9c00;
 	for (int i = 0; i < WINDOW_HEIGHT_TILES; i++) {
 		for (int j = 0; j < WINDOW_WIDTH_TILES; j++) {
-			uint8_t id = mem_read(ppu->mem, adr + i * WINDOW_WIDTH_TILES + j);
+			uint8_t id = ppu->mem[adr + i * WINDOW_WIDTH_TILES + j];
 			uint8_t **tile = get_tile(ppu, id);
 			draw_tile(ppu, ppu->debug_wfb, tile, j * 8, i * 8);
 			for (int k = 0; k < 8; k++)
@@ -135,7 +137,7 @@ debug_draw(struct PPU *ppu)
 void
 request_stat(struct PPU *ppu)
 {
-	uint8_t stat = mem_read(ppu->mem, STAT);
+	uint8_t stat = ppu->mem[STAT];
 
 	uint8_t line = 0;
 
@@ -144,8 +146,7 @@ request_stat(struct PPU *ppu)
 	}
 
 	if (line != 0 && statline == 0) {
-		request_interrupt(ppu->mem, INTERRUPT_STAT);
-		fprintf(ppu->log, "int %d\n", INTERRUPT_STAT);
+		interrupt_request(ppu->mem, INTERRUPT_STAT);
 	}
 
 	statline = line;
@@ -155,7 +156,7 @@ struct LCD_Control
 read_lcdc(struct PPU *ppu)
 {
 	struct LCD_Control lcdc = {0};
-	uint8_t tmp = mem_read(ppu->mem, LCDC);
+	uint8_t tmp = ppu->mem[LCDC];
 
 	lcdc.enable = tmp & (1 << 7) ? 1 : 0;
 	lcdc.w_tmap = tmp & (1 << 6) ? 1 : 0;
@@ -183,8 +184,8 @@ get_tile_row(struct PPU *ppu, uint8_t id, uint8_t row, enum TILE_TYPE type)
 		adr = 0x9000 + (int8_t)id * BYTES_PER_TILE;
 	}
 
-	l = mem_read(ppu->mem, adr + row * 2);
-	h = mem_read(ppu->mem, adr + row * 2 + 1);
+	l = ppu->mem[adr + row * 2];
+	h = ppu->mem[adr + row * 2 + 1];
 
 	for (int j = 0; j < 8; j++) {
 		uint8_t b1 = h & (1 << (7 - j)) ? 1 : 0;
@@ -201,11 +202,11 @@ uint8_t *
 get_bg_row(struct PPU *ppu, uint16_t adr, uint8_t ly)
 {
 	uint8_t *row = calloc(20 + 1, sizeof(uint8_t *));
-	uint8_t scy = mem_read(ppu->mem, SCY);
-	uint8_t scx = mem_read(ppu->mem, SCX);
+	uint8_t scy = ppu->mem[SCY];
+	uint8_t scx = ppu->mem[SCX];
 
 	for (int i = 0; i < LCD_WIDTH_TILES + 1; i++) {
-		row[i] = mem_read(ppu->mem, adr + ((ly + scy)/8 % WINDOW_HEIGHT_TILES) * WINDOW_WIDTH_TILES + (i + scx/8) % WINDOW_WIDTH_TILES);
+		row[i] = ppu->mem[adr + ((ly + scy)/8 % WINDOW_HEIGHT_TILES) * WINDOW_WIDTH_TILES + (i + scx/8) % WINDOW_WIDTH_TILES];
 	}
 
 	return row;
@@ -218,7 +219,7 @@ get_window_row(struct PPU *ppu, uint16_t adr)
 	uint8_t *row = calloc(WINDOW_WIDTH_TILES, sizeof(uint8_t *));
 
 	for (int i = 0; i < WINDOW_WIDTH_TILES; i++) {
-		row[i] = mem_read(ppu->mem, adr + (wly)/8 * WINDOW_WIDTH_TILES + i);
+		row[i] = ppu->mem[adr + (wly)/8 * WINDOW_WIDTH_TILES + i];
 	}
 
 	return row;
@@ -233,11 +234,11 @@ get_sprite(struct PPU *ppu, uint8_t id)
 	if (s == NULL)
 		return NULL;
 
-	s->y = mem_read(ppu->mem, adr);
-	s->x = mem_read(ppu->mem, adr + 1);
-	s->tile_id = mem_read(ppu->mem, adr + 2);
+	s->y = ppu->mem[adr];
+	s->x = ppu->mem[adr + 1];
+	s->tile_id = ppu->mem[adr + 2];
 
-	uint8_t flag = mem_read(ppu->mem, adr + 3);
+	uint8_t flag = ppu->mem[adr + 3];
 
 	s->priority = (flag & (1 << 7)) >> 7;
 	s->yflip = (flag & (1 << 6)) >> 6;
@@ -314,26 +315,18 @@ ppu_init(uint8_t *mem)
 	if (mem != NULL)
 		ppu->mem = mem;
 
-	ppu->log = fopen("ppu.log", "w");
-
-	if (ppu->log == NULL) {
-		fprintf(stderr, "unable to open ppu log for writing\n");
-		free(ppu);
-		return NULL;
-	}
-
 	ppu->mode.mode = OAM_SCAN;
 
 	/* https://bgb.bircd.org/pandocs.htm#powerupsequence */
-	mem_write(ppu->mem, LCDC, 0x91);
-	mem_write(ppu->mem, SCY, 0x00);
-	mem_write(ppu->mem, SCX, 0x00);
-	mem_write(ppu->mem, LYC, 0x00);
-	mem_write(ppu->mem, BGP, 0xfc);
-	mem_write(ppu->mem, OBP0, 0xff);
-	mem_write(ppu->mem, OBP1, 0xff);
-	mem_write(ppu->mem, WY, 0x00);
-	mem_write(ppu->mem, WX, 0x00);
+	ppu->mem[LCDC] = 0x91;
+	ppu->mem[SCY] = 0x00;
+	ppu->mem[SCX] = 0x00;
+	ppu->mem[LYC] = 0x00;
+	ppu->mem[BGP] = 0xfc;
+	ppu->mem[OBP0] = 0xff;
+	ppu->mem[OBP1] = 0xff;
+	ppu->mem[WY] = 0x00;
+	ppu->mem[WX] = 0x00;
 
 
 	if (graphics_init(ppu)) {
@@ -366,13 +359,14 @@ set_ppu_mode(struct PPU *ppu, enum PPU_MODE mode)
 		assert(NULL); /* unreachable */
 		break;
 	}
-	mem_write(ppu->mem, STAT, mem_read(ppu->mem, STAT) | mode);
+	/* the low two bits, the cpu can't write them */
+	ppu->mem[STAT] = (ppu->mem[STAT] & ~3) | mode;
 }
 
 uint8_t
 get_color(struct PPU *ppu, uint8_t id, enum Pallete pallete)
 {
-	return (mem_read(ppu->mem, pallete) & (3 << (id * 2))) >> (id * 2);
+	return (ppu->mem[pallete] & (3 << (id * 2))) >> (id * 2);
 }
 
 void
@@ -473,8 +467,8 @@ sprite_render_row(struct PPU *ppu, struct Sprite *s, uint8_t ly)
 void
 render_bg_row(struct PPU *ppu, uint8_t *row, uint8_t ly)
 {
-	uint8_t scy = mem_read(ppu->mem, SCY);
-	uint8_t scx = mem_read(ppu->mem, SCX);
+	uint8_t scy = ppu->mem[SCY];
+	uint8_t scx = ppu->mem[SCX];
 
 	// for (int i = 0; i < LCD_WIDTH_TILES; i++) {
 	// 	uint8_t *pix = get_tile_row(ppu, row[i], (ly + scy) % 8, WINDOW);
@@ -492,8 +486,8 @@ render_bg_row(struct PPU *ppu, uint8_t *row, uint8_t ly)
 void
 render_window_row(struct PPU *ppu, uint8_t *row, uint8_t ly)
 {
-	uint8_t wy = mem_read(ppu->mem, WY);
-	uint8_t wx = mem_read(ppu->mem, WX);
+	uint8_t wy = ppu->mem[WY];
+	uint8_t wx = ppu->mem[WX];
 
 	if (wy > ly)
 		return;
@@ -519,7 +513,7 @@ write_lcdc(struct PPU *ppu, struct LCD_Control *lcdc)
 	new |= lcdc->obj_size << 2;
 	new |= lcdc->obj_enable << 1;
 	new |= lcdc->bgwin_enable;
-	mem_write(ppu->mem, LCDC, new);
+	ppu->mem[LCDC] = new;
 }
 
 struct Sprite **
@@ -550,7 +544,7 @@ oam_scan(struct PPU *ppu, uint8_t ly)
 void
 ppu_draw(struct PPU *ppu, struct Sprite **list)
 {
-	uint8_t ly = mem_read(ppu->mem, LY);
+	uint8_t ly = ppu->mem[LY];
 
 	uint16_t adr = 0x9800;
 	if (ppu->lcdc.bg_tmap)
@@ -587,8 +581,8 @@ ppu_draw(struct PPU *ppu, struct Sprite **list)
 void
 ppu_run_cycle(struct PPU *ppu)
 {
-	uint8_t ly = mem_read(ppu->mem, LY);
-	uint8_t lyc = mem_read(ppu->mem, LYC);
+	uint8_t ly = ppu->mem[LY];
+	uint8_t lyc = ppu->mem[LYC];
 	ppu->lcdc = read_lcdc(ppu);
 
 	set_ppu_mode(ppu, ppu->mode.mode);
@@ -613,10 +607,10 @@ ppu_run_cycle(struct PPU *ppu)
 
 			if (ly >= 143) {
 				set_ppu_mode(ppu, VBLANK);
-				request_interrupt(ppu->mem, INTERRUPT_VBLANK);
+				interrupt_request(ppu->mem, INTERRUPT_VBLANK);
 			} else {
 				set_ppu_mode(ppu, OAM_SCAN);
-				mem_write(ppu->mem, LY, ly + 1);
+				ppu->mem[LY] = ly + 1;
 			}
 
 			ppu->tcycles = 0;
@@ -630,10 +624,10 @@ ppu_run_cycle(struct PPU *ppu)
 			if (ly >= 153) {
 				ppu->tcycles = 0;
 				ly = 0;
-				mem_write(ppu->mem, LY, 0);
+				ppu->mem[LY] = 0;
 				set_ppu_mode(ppu, OAM_SCAN);
 			} else {
-				mem_write(ppu->mem, LY, ly + 1);
+				ppu->mem[LY] = ly + 1;
 			}
 			break;
 	}
@@ -641,9 +635,9 @@ ppu_run_cycle(struct PPU *ppu)
 	request_stat(ppu);
 
 	if (ly == lyc) {
-		mem_write(ppu->mem, STAT, mem_read(ppu->mem, STAT) | LYC_LC);
+		ppu->mem[STAT] |= LYC_LC;
 	} else {
-		mem_write(ppu->mem, STAT, mem_read(ppu->mem, STAT) & ~LYC_LC);
+		ppu->mem[STAT] &= ~LYC_LC;
 	}
 }
 
@@ -660,19 +654,85 @@ ppu_run(struct PPU *ppu, int cycles)
 	}
 }
 
+/*
+ * LYC or STAT was just written by the cpu. between mode changes only the
+ * LY=LYC compare and the stat line could change, and only after one of
+ * these writes, so they are looked at now instead of on the next dot
+ */
 void
-ppu_log(struct PPU *ppu)
+ppu_stat_written(struct PPU *ppu)
 {
-	fprintf(ppu->log, "CYC: %05d ", ppu->tcycles);
-	fprintf(ppu->log, "LCDC: %08b ", mem_read(ppu->mem, LCDC));
-	fprintf(ppu->log, "LY: %02x ", mem_read(ppu->mem, LY));
-	fprintf(ppu->log, "LYC: %02x ", mem_read(ppu->mem, LYC));
-	fprintf(ppu->log, "STAT: %07b ", mem_read(ppu->mem, STAT));
-	fprintf(ppu->log, "SCX: %02x ", mem_read(ppu->mem, SCX));
-	fprintf(ppu->log, "SCY: %02x ", mem_read(ppu->mem, SCY));
-	fprintf(ppu->log, "WX: %02x ", mem_read(ppu->mem, WX));
-	fprintf(ppu->log, "WY: %02x ", mem_read(ppu->mem, WY));
-	fprintf(ppu->log, "SL: %02x ", statline);
-	fprintf(ppu->log, "\n");
+	if (!read_lcdc(ppu).enable)
+		return;
+
+	if (ppu->mem[LY] == ppu->mem[LYC])
+		ppu->mem[STAT] |= LYC_LC;
+	else
+		ppu->mem[STAT] &= ~LYC_LC;
+	request_stat(ppu);
 }
 
+/*
+ * mcycles until the next mode change, running fewer leaves every register
+ * alone as long as writes to LYC and STAT go through ppu_stat_written
+ */
+int
+ppu_next_event(struct PPU *ppu)
+{
+	int dots;
+
+	if (!read_lcdc(ppu).enable)
+		return INT_MAX;
+
+	switch (ppu->mode.mode) {
+		case OAM_SCAN:
+			dots = 80 - ppu->tcycles;
+			break;
+		case DRAW:
+			dots = 80 + 289 - ppu->tcycles;
+			break;
+		default:
+			dots = 456 - ppu->tcycles;
+			break;
+	}
+
+	return dots < 0 ? 0 : dots / 4 + 1;
+}
+
+/* same as ppu_run for a stretch without mode changes */
+void
+ppu_skip(struct PPU *ppu, int cycles)
+{
+	ppu->lcdc = read_lcdc(ppu);
+
+	if (!ppu->lcdc.enable)
+		return;
+
+	ppu->tcycles += cycles * 4;
+}
+
+/*
+ * runs the ppu from at up to now, a mode change at a time with the stretches
+ * in between skipped. returns ppu_next_event
+ */
+int
+ppu_catchup(struct PPU *ppu, uint64_t now)
+{
+	uint64_t n = now - ppu->at;
+
+	ppu->at = now;
+	while (n > 0) {
+		int next = ppu_next_event(ppu);
+		uint64_t quiet = next > 1 ? next - 1 : 0;
+
+		if (quiet >= n) {
+			ppu_skip(ppu, n);
+			break;
+		}
+		ppu_skip(ppu, quiet);
+		ppu_run(ppu, 1);
+		n -= quiet + 1;
+	}
+
+	return ppu_next_event(ppu);
+}
@@ -106,6 +106,7 @@ struct PPU {
 
 	uint8_t *mem;
 	uint16_t tcycles;
+	uint64_t at; /* cpu mcycles it has been run up to, see ppu_catchup */
 
 	SDL_Window *win;
 	uint32_t *fb;
@@ -118,12 +119,13 @@ struct PPU {
 
 	SDL_Window *debug_owin;
 	uint32_t *debug_ofb;
-
-	FILE *log;
 };
 
 
 struct PPU *ppu_init(uint8_t *mem);
 void ppu_run(struct PPU *ppu, int cycles);
+int ppu_next_event(struct PPU *ppu);
+void ppu_stat_written(struct PPU *ppu);
+void ppu_skip(struct PPU *ppu, int cycles);
+int ppu_catchup(struct PPU *ppu, uint64_t now);
 void debug_draw(struct PPU *ppu);
-void ppu_log(struct PPU *ppu);
@@ -0,0 +1,157 @@
+/*
+ * The profiler runs the guest an instruction at a time with execute(), so
+ * every cycle lands on the pc that spent it whatever engine was picked. gb_run
+ * only looks at it while it is on, which leaves the engines untouched.
+ */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cpu.h"
+#include "opcode.h"
+#include "prof.h"
+
+struct Prof *
+prof_init(void)
+{
+	return calloc(1, sizeof(struct Prof));
+}
+
+/* one instruction, returns its mcycles like the engine steps */
+int
+prof_step(struct Prof *prof, struct CPU *cpu)
+{
+	uint16_t pc = cpu->pc;
+	uint8_t halted = cpu->halt || cpu->stop;
+	uint64_t mcycles = cpu->mcycles;
+	uint64_t *count = &prof->count[pc], *cyc = &prof->cycles[pc];
+
+	/* before it runs, the instruction may switch its own bank out */
+	int bank = cart_bank(cpu, pc);
+	if (bank >= 0) {
+		struct ProfBank **b = &prof->banks[pc / ROM_BANK][bank];
+		if (*b == NULL)
+			*b = calloc(1, sizeof(struct ProfBank));
+		/* without the memory it goes in with the pcs, bank unknown */
+		if (*b != NULL) {
+			count = &(*b)->count[pc % ROM_BANK];
+			cyc = &(*b)->cycles[pc % ROM_BANK];
+		}
+	}
+
+	int cycles = execute(cpu);
+
+	if (halted) {
+		prof->halted += cycles;
+	} else {
+		(*count)++;
+		*cyc += cycles;
+	}
+	prof->dispatch += cpu->mcycles - mcycles - cycles;
+
+	return cycles;
+}
+
+struct Spot {
+	int bank; /* -1 outside the rom */
+	uint16_t pc;
+	uint64_t count;
+	uint64_t cycles;
+};
+
+static int
+hotter(const void *a, const void *b)
+{
+	const struct Spot *x = a, *y = b;
+
+	if (x->cycles != y->cycles)
+		return x->cycles < y->cycles ? 1 : -1;
+	if (x->bank != y->bank)
+		return x->bank - y->bank;
+	return x->pc - y->pc;
+}
+
+/* every pc that ran, spots NULL to only count them */
+static int
+collect(const struct Prof *prof, struct Spot *spots)
+{
+	int n = 0;
+
+	for (int pc = 0; pc < 1 << 16; pc++) {
+		if (prof->count[pc] == 0)
+			continue;
+		if (spots != NULL)
+			spots[n] = (struct Spot){-1, pc, prof->count[pc], prof->cycles[pc]};
+		n++;
+	}
+
+	for (int w = 0; w < 2; w++) {
+		for (int bank = 0; bank < ROM_BANKS_MAX; bank++) {
+			const struct ProfBank *b = prof->banks[w][bank];
+			if (b == NULL)
+				continue;
+			for (int i = 0; i < ROM_BANK; i++) {
+				if (b->count[i] == 0)
+					continue;
+				if (spots != NULL)
+					spots[n] = (struct Spot){bank, w * ROM_BANK + i, b->count[i], b->cycles[i]};
+				n++;
+			}
+		}
+	}
+
+	return n;
+}
+
+/* the instruction bytes at a spot, from its own bank whatever is mapped now */
+static void
+fetch(const struct CPU *cpu, const struct Spot *s, uint8_t op[3])
+{
+	const struct Cart *cart = cpu->cart;
+
+	for (int i = 0; i < 3; i++) {
+		size_t off = (size_t)s->bank * ROM_BANK + (s->pc % ROM_BANK) + i;
+		if (s->bank >= 0 && off < cart->rom_size)
+			op[i] = cart->rom[off];
+		else
+			op[i] = cpu_peek(cpu, s->pc + i);
+	}
+}
+
+/* the top pcs by mcycles as bank:pc, disassembled from the bank that ran */
+void
+prof_report(const struct Prof *prof, const struct CPU *cpu, FILE *out, int top)
+{
+	int n = collect(prof, NULL);
+	struct Spot *spots = malloc(sizeof(struct Spot) * (n ? n : 1));
+	uint64_t total = prof->halted + prof->dispatch;
+
+	if (spots == NULL)
+		return;
+
+	collect(prof, spots);
+	for (int i = 0; i < n; i++)
+		total += spots[i].cycles;
+	qsort(spots, n, sizeof(struct Spot), hotter);
+
+	fprintf(out, "profile: %llu mcycles, %llu halted, %llu taking interrupts\n",
+		(unsigned long long)total, (unsigned long long)prof->halted,
+		(unsigned long long)prof->dispatch);
+	fprintf(out, "  bank:pc      count       mcycles      %%  instruction\n");
+
+	for (int i = 0; i < n && i < top; i++) {
+		uint8_t op[3];
+		char bank[12] = "--";
+		fetch(cpu, &spots[i], op);
+		char *mnemonic = get_mnemonic(op);
+
+		if (spots[i].bank >= 0)
+			snprintf(bank, sizeof(bank), "%02x", spots[i].bank);
+		fprintf(out, "  %3s:%04x %10llu %13llu %6.2f  %s\n", bank, spots[i].pc,
+			(unsigned long long)spots[i].count, (unsigned long long)spots[i].cycles,
+			100.0 * spots[i].cycles / (total ? total : 1), mnemonic);
+		free(mnemonic);
+	}
+
+	free(spots);
+}
@@ -0,0 +1,30 @@
+#ifndef PROF_H
+#define PROF_H
+#include <stdint.h>
+#include <stdio.h>
+#include "cart.h"
+#include "cpu.h"
+
+/* counts for the pcs of one rom bank in one of the two windows */
+struct ProfBank {
+	uint64_t count[ROM_BANK];
+	uint64_t cycles[ROM_BANK];
+};
+
+/*
+ * guest hot spots, instructions and mcycles by the pc they started at. a
+ * pc in the rom also goes by the bank that was mapped there
+ */
+struct Prof {
+	int on;
+	uint64_t count[1 << 16]; /* ram, or the rom without a cartridge */
+	uint64_t cycles[1 << 16];
+	struct ProfBank *banks[2][ROM_BANKS_MAX]; /* by window then bank, NULL until run from */
+	uint64_t halted; /* waiting for an interrupt */
+	uint64_t dispatch; /* taking interrupts */
+};
+
+struct Prof *prof_init(void);
+int prof_step(struct Prof *prof, struct CPU *cpu);
+void prof_report(const struct Prof *prof, const struct CPU *cpu, FILE *out, int top);
+#endif /* PROF_H */
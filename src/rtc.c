@@ -0,0 +1,135 @@
+/*
+ * The MBC3 clock is never ticked. It keeps its registers as of a base time
+ * and works out how far they have got only when the game latches or sets
+ * them, so running costs nothing per cycle. The footer of the .sav file is
+ * the format other emulators use: the registers and their latched copies as
+ * 32-bit words, then the unix time the registers are as of.
+ */
+#include <stdint.h>
+#include <time.h>
+
+#include "rtc.h"
+
+enum {
+	MCYCLES_PER_SECOND = 4194304 / 4,
+};
+
+static const uint8_t mask[RTC_REGS] = { 0x3f, 0x3f, 0x1f, 0xff, 0xc1 };
+
+static int64_t
+now(const struct RTC *rtc, uint64_t mcycles)
+{
+	if (rtc->emulated)
+		return mcycles / MCYCLES_PER_SECOND;
+	return time(NULL);
+}
+
+static void
+put(uint8_t *p, uint64_t x, int n)
+{
+	for (int i = 0; i < n; i++)
+		p[i] = x >> (8 * i);
+}
+
+static uint64_t
+get(const uint8_t *p, int n)
+{
+	uint64_t x = 0;
+
+	for (int i = 0; i < n; i++)
+		x |= (uint64_t)p[i] << (8 * i);
+	return x;
+}
+
+static void
+store(const struct RTC *rtc)
+{
+	uint8_t *f = rtc->footer;
+
+	if (f == NULL)
+		return;
+	for (int i = 0; i < RTC_REGS; i++) {
+		put(&f[4 * i], rtc->r[i], 4);
+		put(&f[4 * (RTC_REGS + i)], rtc->latched[i], 4);
+	}
+	/* the registers were just brought up to the host's now in emulated time */
+	put(&f[8 * RTC_REGS], rtc->emulated ? time(NULL) : rtc->base, 8);
+}
+
+/* the registers counted on to t */
+static void
+advance(struct RTC *rtc, int64_t t)
+{
+	uint8_t *r = rtc->r;
+
+	if (!(r[RTC_DH] & RTC_HALT) && t > rtc->base) {
+		uint64_t days = (r[RTC_DH] & 1) << 8 | r[RTC_DL];
+		uint64_t s = (t - rtc->base) + r[RTC_SEC] + 60 * r[RTC_MIN] + 3600 * r[RTC_HOUR] + 86400 * days;
+
+		days = s / 86400;
+		r[RTC_SEC] = s % 60;
+		r[RTC_MIN] = s / 60 % 60;
+		r[RTC_HOUR] = s / 3600 % 24;
+		r[RTC_DL] = days & 0xff;
+		r[RTC_DH] = (r[RTC_DH] & ~1) | (days >> 8 & 1);
+		if (days > 511)
+			r[RTC_DH] |= RTC_CARRY;
+	}
+	rtc->base = t;
+}
+
+/* from a footer that was saved before, or a clock at zero starting now */
+void
+rtc_init(struct RTC *rtc, uint8_t *footer, int valid)
+{
+	*rtc = (struct RTC){ .footer = footer, .base = time(NULL) };
+
+	if (footer != NULL && valid) {
+		for (int i = 0; i < RTC_REGS; i++) {
+			rtc->r[i] = get(&footer[4 * i], 4) & mask[i];
+			rtc->latched[i] = get(&footer[4 * (RTC_REGS + i)], 4) & mask[i];
+		}
+		/* the 44 byte footer has a 32-bit time and zeros past it */
+		rtc->base = get(&footer[8 * RTC_REGS], 8);
+	}
+	store(rtc);
+}
+
+/*
+ * runs on emulated seconds from the first mcycle, with the registers as they
+ * were saved, so a replay sees the same clock however long it takes
+ */
+void
+rtc_emulated(struct RTC *rtc)
+{
+	rtc->emulated = 1;
+	rtc->base = 0;
+}
+
+/* writing 0 then 1 copies the running registers to the ones read */
+void
+rtc_latch(struct RTC *rtc, uint8_t data, uint64_t mcycles)
+{
+	if (rtc->latch == 0 && data == 1) {
+		advance(rtc, now(rtc, mcycles));
+		for (int i = 0; i < RTC_REGS; i++)
+			rtc->latched[i] = rtc->r[i];
+		store(rtc);
+	}
+	rtc->latch = data;
+}
+
+uint8_t
+rtc_read(const struct RTC *rtc, int reg)
+{
+	return rtc->latched[reg];
+}
+
+/* sets a running register, the time up to now counts toward the old value */
+void
+rtc_write(struct RTC *rtc, int reg, uint8_t data, uint64_t mcycles)
+{
+	advance(rtc, now(rtc, mcycles));
+	rtc->r[reg] = data & mask[reg];
+	store(rtc);
+}
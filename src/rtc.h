@@ -0,0 +1,36 @@
+#ifndef RTC_H
+#define RTC_H
+#include <stdint.h>
+
+/* the clock registers, selected as mbc3 ram banks 8-c */
+enum RTC_REG {
+	RTC_SEC,
+	RTC_MIN,
+	RTC_HOUR,
+	RTC_DL, /* day, low 8 bits */
+	RTC_DH, /* day bit 8, halt and day carry */
+	RTC_REGS,
+};
+
+enum {
+	RTC_HALT = 0x40,
+	RTC_CARRY = 0x80, /* the day counter went past 511 */
+	RTC_FOOTER = 48, /* bytes after the ram in a .sav file */
+};
+
+/* registers as of base, counted on from there only when the game looks */
+struct RTC {
+	uint8_t r[RTC_REGS];
+	uint8_t latched[RTC_REGS]; /* what the game reads */
+	uint8_t latch; /* the last write to 6000-7fff */
+	uint8_t emulated; /* seconds of mcycles rather than the host's, for replays */
+	int64_t base;
+	uint8_t *footer; /* in the .sav mapping, kept up to date */
+};
+
+void rtc_init(struct RTC *rtc, uint8_t *footer, int valid);
+void rtc_emulated(struct RTC *rtc);
+void rtc_latch(struct RTC *rtc, uint8_t data, uint64_t mcycles);
+uint8_t rtc_read(const struct RTC *rtc, int reg);
+void rtc_write(struct RTC *rtc, int reg, uint8_t data, uint64_t mcycles);
+#endif /* RTC_H */
@@ -0,0 +1,85 @@
+/*
+ * The event heap behind cpu->mcycles, the one clock everything runs on.
+ * Components schedule when they next need the cpu's attention and
+ * cpu_catchup handles whatever is due, so nothing is polled per instruction.
+ */
+#include <stdint.h>
+
+#include "sched.h"
+
+static void
+swap(struct Sched *s, int i, int j)
+{
+	struct Event e = s->heap[i];
+
+	s->heap[i] = s->heap[j];
+	s->heap[j] = e;
+	s->pos[s->heap[i].kind] = i + 1;
+	s->pos[s->heap[j].kind] = j + 1;
+}
+
+/* moves heap[i] to where it belongs, returns its new index */
+static int
+sift(struct Sched *s, int i)
+{
+	while (i > 0 && s->heap[(i - 1) / 2].at > s->heap[i].at) {
+		swap(s, i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	}
+
+	for (;;) {
+		int min = i;
+		for (int c = 2 * i + 1; c <= 2 * i + 2 && c < s->n; c++) {
+			if (s->heap[c].at < s->heap[min].at)
+				min = c;
+		}
+		if (min == i)
+			return i;
+		swap(s, i, min);
+		i = min;
+	}
+}
+
+/* schedules kind at mcycle at, moving it if it was already pending */
+void
+sched_set(struct Sched *s, enum EVENT kind, uint64_t at)
+{
+	int i = s->pos[kind] - 1;
+
+	if (i < 0) {
+		i = s->n++;
+		s->heap[i].kind = kind;
+		s->pos[kind] = i + 1;
+	}
+	s->heap[i].at = at;
+	sift(s, i);
+}
+
+void
+sched_cancel(struct Sched *s, enum EVENT kind)
+{
+	int i = s->pos[kind] - 1;
+
+	if (i < 0)
+		return;
+
+	s->n--;
+	if (i != s->n) {
+		swap(s, i, s->n);
+		sift(s, i);
+	}
+	s->pos[kind] = 0;
+}
+
+/* takes the earliest event due by now, returns its kind or -1 */
+int
+sched_pop(struct Sched *s, uint64_t now)
+{
+	if (s->n == 0 || s->heap[0].at > now)
+		return -1;
+
+	int kind = s->heap[0].kind;
+	sched_cancel(s, kind);
+
+	return kind;
+}
@@ -0,0 +1,37 @@
+#ifndef SCHED_H
+#define SCHED_H
+#include <stdint.h>
+
+/* things that happen at a known mcycle whatever the cpu does meanwhile */
+enum EVENT {
+	EVENT_PPU, /* next mode change */
+	EVENT_TIMER, /* TIMA overflow */
+	EVENT_SERIAL, /* transfer done */
+	EVENT_DMA, /* oam dma done */
+	EVENT_COUNT,
+};
+
+#define SCHED_NEVER UINT64_MAX
+
+struct Event {
+	uint64_t at; /* mcycles */
+	uint8_t kind;
+};
+
+/* min-heap on at, every kind pending at most once. all zero is empty */
+struct Sched {
+	struct Event heap[EVENT_COUNT];
+	uint8_t pos[EVENT_COUNT]; /* index into heap + 1, 0 when not pending */
+	int n;
+};
+
+void sched_set(struct Sched *s, enum EVENT kind, uint64_t at);
+void sched_cancel(struct Sched *s, enum EVENT kind);
+int sched_pop(struct Sched *s, uint64_t now);
+
+static inline uint64_t
+sched_next(const struct Sched *s)
+{
+	return s->n ? s->heap[0].at : SCHED_NEVER;
+}
+#endif /* SCHED_H */
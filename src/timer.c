@@ -1,56 +1,118 @@
-#include <assert.h>
+/*
+ * DIV is the top byte of a 16-bit counter that goes up every tcycle and TIMA
+ * ticks on each falling edge of one of its bits (picked by TAC) while the
+ * timer is enabled. Both follow from the counter alone, so catching up is a
+ * division instead of a tick at a time, and writes to DIV or TAC that pull
+ * the selected bit low tick TIMA just like the counter does.
+ */
+#include <limits.h>
 #include <stdint.h>
 #include <stdio.h>
 
 #include "cpu.h"
+#include "interrupt.h"
 #include "mem.h"
 #include "timer.h"
 
-static uint8_t sum = 0;
+/* tcycles between falling edges of the counter bit each TAC clock watches */
+static const uint16_t periods[4] = { 1024, 16, 64, 256 };
 
+/* the bit TIMA ticks on, anded with the enable */
+static int
+signal(const struct CPU *cpu, uint8_t tac)
+{
+	return (tac & TAC_ENABLE) && (cpu->div & periods[tac & TAC_CLOCK] >> 1);
+}
+
+/* n falling edges, overflowing reloads TMA and requests the interrupt */
 static void
-incr(struct CPU *cpu, uint8_t cycles, uint16_t period) {
-	uint8_t tima = mem_read(cpu->memory, TIMA);
+tick(struct CPU *cpu, uint64_t n)
+{
+	uint8_t *mem = cpu->memory;
+	int room = 0x100 - mem[TIMA];
+
+	if (n < (uint64_t)room) {
+		mem[TIMA] += n;
+		return;
+	}
 
-	sum += cycles;
+	n -= room;
+	mem[TIMA] = mem[TMA] + n % (0x100 - mem[TMA]);
+	interrupt_request(mem, INTERRUPT_TIMER);
+}
+
+/* runs the counter over the mcycles since it was last brought up to date */
+void
+timer_catchup(struct CPU *cpu)
+{
+	uint8_t tac = cpu->memory[TAC];
+	uint64_t t = (cpu->mcycles - cpu->timer_at) * 4;
+	uint64_t end = cpu->div + t;
 
-	while (sum >= period) {
-		sum -= period;
-		mem_write(cpu->memory, TIMA, ++tima);
+	cpu->timer_at = cpu->mcycles;
 
-		if (tima == 0x00) {
-			mem_write(cpu->memory, TIMA, mem_read(cpu->memory, TMA));
-			request_interrupt(cpu->memory, INTERRUPT_TIMER);
-		}
+	if (tac & TAC_ENABLE) {
+		uint16_t period = periods[tac & TAC_CLOCK];
+		uint64_t n = end / period - cpu->div / period;
+		if (n > 0)
+			tick(cpu, n);
 	}
+
+	cpu->div = end;
+	/* not through the bus, where a write clears DIV */
+	cpu->memory[DIV] = cpu->div >> 8;
 }
 
+/*
+ * DIV or TAC was just written by the cpu, old being the byte it replaced.
+ * a write that drops the selected bit (or the enable) is a falling edge too
+ */
 void
-timer_incr(struct CPU *cpu, int cycles)
+timer_written(struct CPU *cpu, uint16_t adr, uint8_t old)
 {
-	uint8_t tac = mem_read(cpu->memory, TAC);
-	cpu->div += cycles * 4;
+	uint8_t tac = cpu->memory[TAC];
+	int was = signal(cpu, adr == TAC ? old : tac);
 
-	mem_write(cpu->memory, DIV, cpu->div >> 8);
+	if (adr == DIV) {
+		cpu->div = 0;
+		cpu->memory[DIV] = 0;
+	}
 
-	if ((tac & TAC_ENABLE) == 0)
-		return;
+	if (was && !signal(cpu, tac))
+		tick(cpu, 1);
+}
+
+/* mcycles until TIMA (and DIV if asked) next changes, skipping fewer is safe */
+int
+timer_next_event(struct CPU *cpu, int div)
+{
+	uint8_t tac = cpu->memory[TAC];
+	int next = INT_MAX;
 
-	switch (tac & TAC_CLOCK) {
-		case 0:
-			incr(cpu, cycles, 256);
-		break;
-		case 1:
-			incr(cpu, cycles, 4);
-		break;
-		case 2:
-			incr(cpu, cycles, 16);
-		break;
-		case 3:
-			incr(cpu, cycles, 64);
-		break;
-		default:
-			assert(NULL); /* unreachable */
-		break;
+	if (div)
+		next = (256 - (cpu->div & 0xff) + 3) / 4;
+
+	if (tac & TAC_ENABLE) {
+		uint16_t period = periods[tac & TAC_CLOCK];
+		int tima = (period - cpu->div % period) / 4;
+		if (tima < next)
+			next = tima;
 	}
+
+	return next;
+}
+
+/* mcycles until TIMA overflows and requests an interrupt */
+int
+timer_next_interrupt(struct CPU *cpu)
+{
+	uint8_t tac = cpu->memory[TAC];
+
+	if ((tac & TAC_ENABLE) == 0)
+		return INT_MAX;
+
+	uint16_t period = periods[tac & TAC_CLOCK];
+	int ticks = 0x100 - cpu->memory[TIMA];
+
+	return ((period - cpu->div % period) + (ticks - 1) * period) / 4;
 }
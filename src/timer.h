@@ -10,4 +10,7 @@ enum {
 	TAC_ENABLE = 1 << 2,
 };
 
-void timer_incr(struct CPU *cpu, int cycles);
+void timer_catchup(struct CPU *cpu);
+void timer_written(struct CPU *cpu, uint16_t adr, uint8_t old);
+int timer_next_event(struct CPU *cpu, int div);
+int timer_next_interrupt(struct CPU *cpu);
@@ -0,0 +1,94 @@
+/*
+ * Instruction traces as fixed size records in a ring that is mapped from a
+ * file. The kernel keeps the pages of a shared mapping however the process
+ * ends, so after a crash the file holds the last TRACE_LEN instructions
+ * with nothing done at crash time. tools/tracefmt.c prints them in the
+ * Gameboy Doctor format.
+ */
+#define _POSIX_C_SOURCE 200809L /* ftruncate */
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "trace.h"
+
+struct Trace *
+trace_open(const char *path)
+{
+	struct Trace *t = calloc(1, sizeof(struct Trace));
+	if (t == NULL)
+		return NULL;
+
+	t->bytes = sizeof(struct TraceHeader) + TRACE_LEN * sizeof(struct TraceRecord);
+
+	int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0 || ftruncate(fd, t->bytes) < 0) {
+		fprintf(stderr, "unable to open trace %s\n", path);
+		if (fd >= 0)
+			close(fd);
+		free(t);
+		return NULL;
+	}
+
+	void *p = mmap(NULL, t->bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED) {
+		free(t);
+		return NULL;
+	}
+
+	t->hdr = p;
+	t->rec = (struct TraceRecord *)(t->hdr + 1);
+	memcpy(t->hdr->magic, TRACE_MAGIC, sizeof(t->hdr->magic));
+	t->hdr->size = sizeof(struct TraceRecord);
+	t->hdr->len = TRACE_LEN;
+
+	return t;
+}
+
+void
+trace_close(struct Trace *t)
+{
+	munmap(t->hdr, t->bytes);
+	free(t);
+}
+
+void
+trace_fill(struct TraceRecord *r, struct CPU *cpu)
+{
+	uint16_t pc = cpu->pc;
+
+	cpu_sync_flags(cpu);
+	*r = (struct TraceRecord){
+		.mcycles = cpu->mcycles,
+		.pc = pc, .sp = cpu->sp,
+		.af = cpu->af, .bc = cpu->bc, .de = cpu->de, .hl = cpu->hl,
+		.op = {cpu_peek(cpu, pc), cpu_peek(cpu, pc + 1), cpu_peek(cpu, pc + 2), cpu_peek(cpu, pc + 3)},
+		.ime = cpu->ime, .halt = cpu->halt,
+	};
+}
+
+/* one instruction through execute(), recorded first */
+int
+trace_step(struct Trace *t, struct CPU *cpu)
+{
+	trace_fill(&t->rec[t->hdr->n++ & (TRACE_LEN - 1)], cpu);
+
+	return execute(cpu);
+}
+
+/* a line of the Gameboy Doctor log */
+void
+trace_print(const struct TraceRecord *r, FILE *f)
+{
+	fprintf(f, "A: %02X F: %02X B: %02X C: %02X D: %02X E: %02X H: %02X "
+		"L: %02X SP: %04X PC: 00:%04X (%02X %02X %02X %02X)\n",
+		r->af >> 8, r->af & 0xff, r->bc >> 8, r->bc & 0xff, r->de >> 8,
+		r->de & 0xff, r->hl >> 8, r->hl & 0xff, r->sp, r->pc,
+		r->op[0], r->op[1], r->op[2], r->op[3]);
+}
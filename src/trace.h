@@ -0,0 +1,40 @@
+#ifndef TRACE_H
+#define TRACE_H
+#include <stdint.h>
+#include <stdio.h>
+
+struct CPU;
+
+#define TRACE_MAGIC "GBTRACE1"
+#define TRACE_LEN (1 << 16) /* records kept, a power of two */
+
+/* the cpu as an instruction found it, before running */
+struct TraceRecord {
+	uint64_t mcycles;
+	uint16_t pc, sp;
+	uint16_t af, bc, de, hl;
+	uint8_t op[4]; /* bytes at pc */
+	uint8_t ime, halt;
+	uint8_t pad[2];
+};
+
+/* start of the trace file, the ring of records follows */
+struct TraceHeader {
+	char magic[8];
+	uint32_t size; /* sizeof(struct TraceRecord) */
+	uint32_t len;
+	uint64_t n; /* records written so far, the last len are kept */
+};
+
+struct Trace {
+	struct TraceHeader *hdr; /* mapped from the file */
+	struct TraceRecord *rec;
+	size_t bytes;
+};
+
+struct Trace *trace_open(const char *path);
+void trace_close(struct Trace *t);
+int trace_step(struct Trace *t, struct CPU *cpu);
+void trace_fill(struct TraceRecord *r, struct CPU *cpu);
+void trace_print(const struct TraceRecord *r, FILE *f);
+#endif /* TRACE_H */
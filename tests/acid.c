@@ -5,7 +5,7 @@ int
 main(void)
 {
 	struct GB *gb = gb_init();
-	if(load_rom(gb->mem, "tests/dmg-acid2.gb"))
+	if(gb_load(gb, "tests/dmg-acid2.gb"))
 		return 1;
 
 
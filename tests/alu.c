@@ -0,0 +1,301 @@
+/*
+ * checks the alu tables against the flag arithmetic they replaced, for
+ * every input. `alu -b` also times both versions per operation.
+ */
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../src/alu.h"
+#include "../src/cpu.h"
+
+/* the per-flag versions from cpu.c, returning f << 8 | result */
+
+static uint16_t
+ref_add(uint8_t a, uint8_t n, uint8_t carry)
+{
+	union Flags f = {0};
+	uint16_t ans = a + n + carry;
+	uint8_t half_ans = (a & 0xf) + (n & 0xf) + carry;
+
+	a = ans;
+	f.z = (a == 0);
+	f.c = ans > 0xff;
+	f.n = 0;
+	f.h = half_ans > 0xf;
+
+	return f.flags << 8 | a;
+}
+
+static uint16_t
+ref_sub(uint8_t a, uint8_t n, uint8_t carry)
+{
+	union Flags f = {0};
+	uint8_t res = a - n - carry;
+
+	f.h = (a & 0xf) < ((n & 0xf) + carry);
+	f.c = n + carry > a;
+	f.n = 1;
+	f.z = (res == 0);
+
+	return f.flags << 8 | res;
+}
+
+static uint16_t
+ref_inc(uint8_t reg, uint8_t carry)
+{
+	union Flags f = {0};
+
+	reg++;
+	f.c = carry;
+	f.n = 0;
+	f.z = (reg == 0);
+	f.h = (reg & 0b1111) == 0b0000;
+
+	return f.flags << 8 | reg;
+}
+
+static uint16_t
+ref_dec(uint8_t reg, uint8_t carry)
+{
+	union Flags f = {0};
+
+	reg--;
+	f.c = carry;
+	f.n = 1;
+	f.z = (reg == 0);
+	f.h = (reg & 0b1111) == 0b1111;
+
+	return f.flags << 8 | reg;
+}
+
+static uint16_t
+ref_daa(uint8_t flags, uint8_t a)
+{
+	union Flags f = { .flags = flags };
+	uint8_t adj = 0;
+
+	if (f.h || (!f.n && (a & 0x0F) > 0x09)) {
+		adj |= 0x06;
+	}
+
+	if (f.c || (!f.n && a > 0x99)) {
+		adj |= 0x60;
+		f.c = 1;
+	}
+
+	a += adj * (f.n ? -1 : 1);
+
+	f.z = (a == 0);
+	f.h = 0;
+
+	return f.flags << 8 | a;
+}
+
+static uint16_t
+ref_shift(int op, uint8_t carry, uint8_t reg)
+{
+	union Flags f = { .flags = carry ? FLAG_C : 0 };
+	uint8_t tmp;
+
+	switch (op) {
+		case SHIFT_RLC:
+			f.c = reg >> 7;
+			reg <<= 1;
+			reg |= f.c;
+			break;
+		case SHIFT_RRC:
+			f.c = reg & 1;
+			reg >>= 1;
+			reg |= f.c << 7;
+			break;
+		case SHIFT_RL:
+			tmp = reg >> 7;
+			reg <<= 1;
+			reg |= f.c;
+			f.c = tmp;
+			break;
+		case SHIFT_RR:
+			tmp = reg & 1;
+			reg >>= 1;
+			reg |= f.c << 7;
+			f.c = tmp;
+			break;
+		case SHIFT_SLA:
+			f.c = reg >> 7;
+			reg <<= 1;
+			break;
+		case SHIFT_SRA:
+			f.c = reg & 1;
+			reg >>= 1;
+			reg |= (reg >> 6) << 7;
+			break;
+		case SHIFT_SWAP:
+			tmp = reg & 0x0f;
+			reg >>= 4;
+			reg |= tmp << 4;
+			f.c = 0;
+			break;
+		case SHIFT_SRL:
+			f.c = reg & 1;
+			reg >>= 1;
+			break;
+	}
+
+	f.z = reg == 0;
+	f.n = 0;
+	f.h = 0;
+
+	return f.flags << 8 | reg;
+}
+
+/* the table versions, as cpu.c uses them */
+
+static uint16_t
+tab_add(uint8_t a, uint8_t n, uint8_t carry)
+{
+	return alu_add_flags(a, n, carry) << 8 | (uint8_t)(a + n + carry);
+}
+
+static uint16_t
+tab_sub(uint8_t a, uint8_t n, uint8_t carry)
+{
+	return alu_sub_flags(a, n, carry) << 8 | (uint8_t)(a - n - carry);
+}
+
+static uint16_t
+tab_inc(uint8_t reg, uint8_t carry)
+{
+	reg++;
+	return (alu_inc[reg] | carry << 4) << 8 | reg;
+}
+
+static uint16_t
+tab_dec(uint8_t reg, uint8_t carry)
+{
+	reg--;
+	return (alu_dec[reg] | carry << 4) << 8 | reg;
+}
+
+static uint16_t
+tab_daa(uint8_t flags, uint8_t a)
+{
+	return alu_daa[(flags >> 4 & 0b111) << 8 | a];
+}
+
+static uint16_t
+tab_shift(int op, uint8_t carry, uint8_t reg)
+{
+	return alu_shift[op][carry][reg];
+}
+
+static int failed;
+
+static void
+check(const char *name, int x, int y, int c, uint16_t want, uint16_t got)
+{
+	if (want == got)
+		return;
+
+	if (failed++ < 16)
+		fprintf(stderr, "%s %02x %02x c=%d: want %04x got %04x\n", name, x, y, c, want, got);
+}
+
+static void
+verify(void)
+{
+	for (int c = 0; c < 2; c++) {
+		for (int x = 0; x < 256; x++) {
+			for (int y = 0; y < 256; y++) {
+				check("add", x, y, c, ref_add(x, y, c), tab_add(x, y, c));
+				check("sub", x, y, c, ref_sub(x, y, c), tab_sub(x, y, c));
+			}
+			check("inc", x, 0, c, ref_inc(x, c), tab_inc(x, c));
+			check("dec", x, 0, c, ref_dec(x, c), tab_dec(x, c));
+			for (int op = 0; op < 8; op++)
+				check("shift", x, op, c, ref_shift(op, c, x), tab_shift(op, c, x));
+		}
+	}
+
+	/* daa only looks at n, h and c */
+	for (int f = 0; f < 0x100; f += 0x10)
+		for (int a = 0; a < 256; a++)
+			check("daa", a, f, 0, ref_daa(f, a), tab_daa(f, a));
+}
+
+static double
+now(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+static volatile uint32_t sink; /* keeps the timed calls alive */
+
+/* ns per call over n inputs */
+#define TIME(ns, loop) do { \
+	uint32_t sum = 0; \
+	double t = now(); \
+	for (int rep = 0; rep < 16; rep++) \
+		loop; \
+	sink = sum; \
+	ns = (now() - t) / (16.0 * n); \
+} while (0)
+
+static void
+bench(void)
+{
+	static const char *names[8] = { "rlc", "rrc", "rl", "rr", "sla", "sra", "swap", "srl" };
+	double before, after;
+	int n;
+
+	printf("%-6s %8s %8s (ns)\n", "op", "before", "after");
+
+	n = 2 << 16;
+	TIME(before, for (int i = 0; i < n; i++) sum += ref_add(i >> 8, i, i >> 16));
+	TIME(after, for (int i = 0; i < n; i++) sum += tab_add(i >> 8, i, i >> 16));
+	printf("%-6s %8.2f %8.2f\n", "adc", before, after);
+
+	TIME(before, for (int i = 0; i < n; i++) sum += ref_sub(i >> 8, i, i >> 16));
+	TIME(after, for (int i = 0; i < n; i++) sum += tab_sub(i >> 8, i, i >> 16));
+	printf("%-6s %8.2f %8.2f\n", "sbc", before, after);
+
+	n = 2 << 8;
+	TIME(before, for (int i = 0; i < n; i++) sum += ref_inc(i, i >> 8));
+	TIME(after, for (int i = 0; i < n; i++) sum += tab_inc(i, i >> 8));
+	printf("%-6s %8.2f %8.2f\n", "inc", before, after);
+
+	TIME(before, for (int i = 0; i < n; i++) sum += ref_dec(i, i >> 8));
+	TIME(after, for (int i = 0; i < n; i++) sum += tab_dec(i, i >> 8));
+	printf("%-6s %8.2f %8.2f\n", "dec", before, after);
+
+	for (int op = 0; op < 8; op++) {
+		TIME(before, for (int i = 0; i < n; i++) sum += ref_shift(op, i >> 8, i));
+		TIME(after, for (int i = 0; i < n; i++) sum += tab_shift(op, i >> 8, i));
+		printf("%-6s %8.2f %8.2f\n", names[op], before, after);
+	}
+
+	n = 16 << 8;
+	TIME(before, for (int i = 0; i < n; i++) sum += ref_daa(i >> 4 & 0xf0, i));
+	TIME(after, for (int i = 0; i < n; i++) sum += tab_daa(i >> 4 & 0xf0, i));
+	printf("%-6s %8.2f %8.2f\n", "daa", before, after);
+}
+
+int
+main(int argc, char **argv)
+{
+	verify();
+	if (failed) {
+		fprintf(stderr, "%d mismatches\n", failed);
+		return 1;
+	}
+	printf("alu tables match\n");
+
+	if (argc > 1 && strcmp(argv[1], "-b") == 0)
+		bench();
+
+	return 0;
+}
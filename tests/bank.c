@@ -0,0 +1,132 @@
+#include "../src/cpu.h"
+#include "../src/gb.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * an mbc1 rom whose banks have different code at the same address, run
+ * until the loop in bank 0 ends. what was decoded from one bank must not
+ * run once another is mapped, on every engine
+ */
+struct Case {
+	const char *name;
+	uint8_t main[32]; /* at 0x100, ends in jr -2 */
+	int len;
+	uint8_t bank[2][8]; /* at 0x4000 in banks 1 and 2 */
+	uint8_t b, c;
+	uint8_t low[4]; /* the end of bank 0, at 0x3ffc */
+};
+
+enum {
+	ENTRY = 0x100,
+	ROM_SIZE = 4 * ROM_BANK,
+	MAX = 1 << 20, /* mcycles */
+};
+
+static const struct Case cases[] = {
+	/* each bank is called often enough to be built and translated */
+	{ "call both", {
+		0x06, 0x00, 0x0e, 0x00,	/* ld b, 0; ld c, 0 */
+		0x16, 0xc8,		/* ld d, 200 */
+		0x3e, 0x01, 0xea, 0x00, 0x20,	/* ld a, 1; ld [0x2000], a */
+		0xcd, 0x00, 0x40,	/* call 0x4000 */
+		0x3e, 0x02, 0xea, 0x00, 0x20,	/* ld a, 2; ld [0x2000], a */
+		0xcd, 0x00, 0x40,	/* call 0x4000 */
+		0x15, 0x20, 0xed,	/* dec d; jr nz */
+		0x18, 0xfe,		/* jr -2 */
+	}, 27, {
+		{ 0x04, 0x04, 0xc9 },	/* inc b; inc b; ret */
+		{ 0x0c, 0xc9 },		/* inc c; ret */
+	}, 144, 200, { 0 } },
+	/* bank 1 maps bank 2 under itself, the rest of its block is stale */
+	{ "switch own bank", {
+		0x06, 0x00, 0x0e, 0x00,	/* ld b, 0; ld c, 0 */
+		0x16, 0xc8,		/* ld d, 200 */
+		0x3e, 0x01, 0xea, 0x00, 0x20,	/* ld a, 1; ld [0x2000], a */
+		0xcd, 0x00, 0x40,	/* call 0x4000 */
+		0x15, 0x20, 0xf5,	/* dec d; jr nz */
+		0x18, 0xfe,		/* jr -2 */
+	}, 19, {
+		{ 0x3e, 0x02, 0xea, 0x00, 0x20,	/* ld a, 2; ld [0x2000], a */
+		  0x04, 0xc9 },		/* inc b; ret */
+		{ 0, 0, 0, 0, 0,
+		  0x0c, 0xc9 },		/* inc c; ret */
+	}, 0, 200, { 0 } },
+	/* bank 0 code runs into either bank, its last instruction takes its operand from it */
+	{ "across 0x4000", {
+		0x06, 0x00, 0x0e, 0x00,	/* ld b, 0; ld c, 0 */
+		0x16, 0xc8,		/* ld d, 200 */
+		0x3e, 0x01, 0xea, 0x00, 0x20,	/* ld a, 1; ld [0x2000], a */
+		0xcd, 0xfc, 0x3f,	/* call 0x3ffc */
+		0x3e, 0x02, 0xea, 0x00, 0x20,	/* ld a, 2; ld [0x2000], a */
+		0xcd, 0xfc, 0x3f,	/* call 0x3ffc */
+		0x15, 0x20, 0xed,	/* dec d; jr nz */
+		0x18, 0xfe,		/* jr -2 */
+	}, 27, {
+		{ 0x01, 0x80, 0x47, 0xc9 },	/* 1; add a, b; ld b, a; ret */
+		{ 0x02, 0x81, 0x4f, 0xc9 },	/* 2; add a, c; ld c, a; ret */
+	}, 200, 144,
+	{ 0x00, 0x00, 0x00, 0x3e } },	/* nop, 3 times; ld a, */
+};
+
+static uint8_t rom[ROM_SIZE];
+
+static int
+run(const struct Case *t, int engine)
+{
+	const char *path = ".build/bank.gb";
+	FILE *f = fopen(path, "wb");
+
+	memset(rom, 0xff, sizeof(rom));
+	rom[0x147] = 0x01; /* mbc1 */
+	rom[0x148] = 0x01; /* 4 banks */
+	rom[0x149] = 0x00;
+	memcpy(&rom[ENTRY], t->main, t->len);
+	memcpy(&rom[ROM_BANK - sizeof(t->low)], t->low, sizeof(t->low));
+	memcpy(&rom[1 * ROM_BANK], t->bank[0], sizeof(t->bank[0]));
+	memcpy(&rom[2 * ROM_BANK], t->bank[1], sizeof(t->bank[1]));
+	if (f == NULL || fwrite(rom, 1, sizeof(rom), f) != sizeof(rom)) {
+		printf("unable to write %s\n", path);
+		return 0;
+	}
+	fclose(f);
+
+	struct GB *gb = gb_init();
+	if (gb_load(gb, path)) {
+		printf("unable to open %s\n", path);
+		return 0;
+	}
+	struct CPU *cpu = gb->cpu;
+	cpu->engine = engine;
+	cpu->pc = ENTRY;
+	cpu->ime = 0;
+
+	uint16_t end = ENTRY + t->len - 2;
+	for (long n = 0; cpu->pc != end && n < MAX;)
+		n += gb_step(cpu);
+
+	if (cpu->pc != end || cpu->b != t->b || cpu->c != t->c) {
+		printf("%s, %s: pc %04x b %d c %d, expected pc %04x b %d c %d\n",
+				t->name, cpu_engines[engine], cpu->pc, cpu->b, cpu->c, end, t->b, t->c);
+		return 0;
+	}
+
+	return 1;
+}
+
+int
+main(void)
+{
+	int n = 0, passed = 0;
+
+	for (int engine = 0; engine < ENGINES; engine++) {
+		if (cpu_engine(cpu_engines[engine]) < 0)
+			continue;
+		for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++, n++)
+			passed += run(&cases[i], engine);
+	}
+	printf("passed %d/%d\n", passed, n);
+
+	return passed != n;
+}
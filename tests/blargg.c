@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 int
 main(int argc, char **argv)
@@ -33,11 +34,20 @@ main(int argc, char **argv)
 		return 1;
 	}
 
-	if (load_rom(gb->mem, roms[atoi(argv[1]) - 1])) {
+	if (gb_load(gb, roms[atoi(argv[1]) - 1])) {
 		printf("unable to open rom\n");
 		return 1;
 	}
 
+	if (argc > 2 && (gb->cpu->engine = cpu_engine(argv[2])) < 0) {
+		printf("unknown engine %s\n", argv[2]);
+		return 1;
+	}
+
+	/* shadow the engine with cpu_execute, stops at the first difference */
+	if (argc > 3 && strcmp(argv[3], "-l") == 0)
+		gb->lockstep = lockstep_init(1, stderr);
+
 	gb_run(gb);
 
 	return 0;
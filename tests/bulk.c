@@ -0,0 +1,112 @@
+#include "../src/bulk.h"
+#include "../src/cpu.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * each loop is run once by the interpreter alone and once with bulk_run
+ * taking over when it branches back, registers, mcycles and memory have to
+ * come out the same
+ */
+struct Case {
+	const char *name;
+	uint8_t prog[32];
+	int len;
+	int bulk; /* whether bulk_run should take the loop */
+};
+
+enum {
+	START = 0xc000,
+	DATA = 0xd000,
+};
+
+static const struct Case cases[] = {
+	{ "copy, dec bc", {
+		0x21, 0x00, 0xd0,	/* ld hl, 0xd000 */
+		0x11, 0x00, 0xd8,	/* ld de, 0xd800 */
+		0x01, 0x00, 0x01,	/* ld bc, 0x100 */
+		0x2a, 0x12, 0x13,	/* ld a, [hl+]; ld [de], a; inc de */
+		0x0b, 0x78, 0xb1,	/* dec bc; ld a, b; or c */
+		0x20, 0xf8,		/* jr nz */
+	}, 17, 1 },
+	{ "fill ld a,n, dec bc", {
+		0x21, 0x00, 0xd0,	/* ld hl, 0xd000 */
+		0x01, 0x80, 0x00,	/* ld bc, 0x80 */
+		0x3e, 0x5a, 0x22,	/* ld a, 0x5a; ld [hl+], a */
+		0x0b, 0x78, 0xb1,	/* dec bc; ld a, b; or c */
+		0x20, 0xf8,		/* jr nz */
+	}, 14, 1 },
+	{ "fill a, dec b", {
+		0x3e, 0x33,		/* ld a, 0x33 */
+		0x21, 0x7f, 0xd0,	/* ld hl, 0xd07f */
+		0x06, 0x40,		/* ld b, 0x40 */
+		0x32, 0x05,		/* ld [hl-], a; dec b */
+		0x20, 0xfc,		/* jr nz */
+	}, 11, 1 },
+	/* a is b|c from the last iteration, not one byte */
+	{ "fill a, dec bc", {
+		0x3e, 0x11,		/* ld a, 0x11 */
+		0x21, 0x00, 0xd0,	/* ld hl, 0xd000 */
+		0x01, 0x80, 0x01,	/* ld bc, 0x180 */
+		0x22,			/* ld [hl+], a */
+		0x0b, 0x78, 0xb1,	/* dec bc; ld a, b; or c */
+		0x20, 0xfa,		/* jr nz */
+	}, 14, 0 },
+};
+
+static uint8_t mem[2][1 << 16];
+
+static struct CPU *
+run(const struct Case *t, uint8_t *m, struct Bulk *bulk)
+{
+	struct CPU *cpu = init_cpu(m);
+
+	for (int i = 0; i < 0x1000; i++)
+		m[DATA + i] = i * 7;
+	memcpy(&m[START], t->prog, t->len);
+	cpu->pc = START;
+	cpu->ime = 0;
+
+	while (cpu->pc != START + t->len) {
+		uint16_t pc = cpu->pc;
+		execute(cpu);
+		if (bulk != NULL && cpu->pc <= pc)
+			bulk_run(bulk, cpu, 1 << 20);
+	}
+	cpu_sync_flags(cpu);
+
+	return cpu;
+}
+
+int
+main(void)
+{
+	int n = sizeof(cases) / sizeof(cases[0]), passed = 0;
+
+	for (int i = 0; i < n; i++) {
+		const struct Case *t = &cases[i];
+		struct Bulk bulk = {0};
+		struct CPU *ref = run(t, mem[0], NULL);
+		struct CPU *cpu = run(t, mem[1], &bulk);
+		int ok = 1;
+
+		if (ref->af != cpu->af || ref->bc != cpu->bc || ref->de != cpu->de
+				|| ref->hl != cpu->hl || ref->mcycles != cpu->mcycles) {
+			printf("%s: registers or mcycles differ\n", t->name);
+			ok = 0;
+		}
+		if (memcmp(&mem[0][DATA], &mem[1][DATA], 0x1000) != 0) {
+			printf("%s: memory differs\n", t->name);
+			ok = 0;
+		}
+		if ((bulk.bytes > 0) != t->bulk) {
+			printf("%s: %s in bulk\n", t->name, t->bulk ? "not run" : "run");
+			ok = 0;
+		}
+		passed += ok;
+	}
+	printf("passed %d/%d\n", passed, n);
+
+	return passed != n;
+}
@@ -5,8 +5,14 @@
 #include <string.h>
 #include <assert.h>
 
+#include "../src/block.h"
 #include "../src/cpu.h"
+#ifdef JIT
+#include "../src/jit.h"
+#endif
+#include "../src/lockstep.h"
 #include "../src/opcode.h"
+#include "../src/trace.h"
 #include "cJSON.h"
 
 struct Test {
@@ -16,6 +22,10 @@ struct Test {
 	int cycles;
 };
 
+static int engine = ENGINE_INTERP;
+static struct Lockstep *lockstep = NULL;
+static struct Bus bus;
+
 char *
 read_test(char *filename)
 {
@@ -39,6 +49,8 @@ read_test(char *filename)
 int
 is_cpu_same(struct CPU *cpu1, struct CPU *cpu2)
 {
+	cpu_sync_flags(cpu1);
+
 	if (cpu1->pc != cpu2->pc) {
 		LOG("pc differ\n")
 		return 1;
@@ -156,47 +168,78 @@ test_from_json(cJSON *json)
 	return test;
 }
 
+/* one bus for whichever cpu is running or printed */
+static void
+attach(struct CPU *cpu)
+{
+	cpu_map(&bus, cpu->memory);
+	cpu->bus = &bus;
+}
+
+static void
+print_state(struct CPU *cpu)
+{
+	struct TraceRecord r;
+
+	trace_fill(&r, cpu);
+	trace_print(&r, stderr);
+}
+
 int
 run_test(cJSON *json)
 {
 	int failed = 0;
 	struct Test *test = test_from_json(json);
-	test->initial.log = stderr;
-	test->final.log = stderr;
 
 
 	struct CPU cpu = test->initial;
 	cpu.memory = calloc(1 << 16, sizeof(uint8_t));
 	memcpy(cpu.memory, test->initial.memory, 1 << 16);
+	cpu.engine = engine;
+	attach(&cpu);
+	if (lockstep != NULL)
+		lockstep_sync(lockstep, &cpu);
 	while (cpu.mcycles < test->cycles) {
 		// cpu.mcycles += execute_opcode(&cpu);
-		cpu.mcycles += cpu_execute(&cpu);
+		int cycles = lockstep ? lockstep_step(lockstep, &cpu, cpu_step) : cpu_step(&cpu);
+		if (cycles < 0) {
+			failed = 1;
+			break;
+		}
+		cpu.mcycles += cycles;
 	}
 
-	if (is_cpu_same(&cpu, &test->final) != 0) {
+	if (failed || is_cpu_same(&cpu, &test->final) != 0) {
 		fprintf(stderr, "FAIL\ntest %s failed\n\n", test->name);
 		fprintf(stderr, "%d\n", test->cycles);
 		fprintf(stderr, "initial\n");
-		print_cpu_state(&test->initial);
+		attach(&test->initial);
+		print_state(&test->initial);
 		fprintf(stderr, "\n");
 
+		cpu_free_tables(&cpu);
 		free(cpu.memory);
 
 		struct CPU cpu = test->initial;
 		cpu.memory = calloc(1 << 16, sizeof(uint8_t));
 		memcpy(cpu.memory, test->initial.memory, 1 << 16);
+		cpu.engine = engine;
+		attach(&cpu);
 		while (cpu.mcycles < test->cycles) {
 			// cpu.mcycles += execute_opcode(&cpu);
-			cpu.mcycles += cpu_execute(&cpu);
-			print_cpu_state(&cpu);
+			cpu.mcycles += cpu_step(&cpu);
+			print_state(&cpu);
 		}
 
 		fprintf(stderr, "\nfinal\n");
-		print_cpu_state(&test->final);
+		attach(&test->final);
+		print_state(&test->final);
 		fprintf(stderr, "\n");
+		cpu_free_tables(&cpu);
 		free(cpu.memory);
 		failed = 1;
 	} else {
+		cpu_free_tables(&cpu);
 		free(cpu.memory);
 	}
 	free(test->initial.memory);
@@ -245,6 +288,21 @@ run_opcode(uint8_t opcode)
 
 int main(int argc, char *argv[])
 {
+	if (argc > 2 && strcmp(argv[1], "-e") == 0) {
+		if ((engine = cpu_engine(argv[2])) < 0) {
+			fprintf(stderr, "unknown engine %s\n", argv[2]);
+			return 1;
+		}
+		argc -= 2;
+		argv += 2;
+	}
+
+	/* check the engine against cpu_execute as well as the expected state */
+	if (argc > 1 && strcmp(argv[1], "-l") == 0) {
+		lockstep = lockstep_init(0, stderr);
+		argc--;
+		argv++;
+	}
 
 	if (argc == 2) {
 		run_opcode(atoi(argv[1]));
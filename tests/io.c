@@ -0,0 +1,71 @@
+#include "../src/cpu.h"
+#include "../src/gb.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * an interrupt requested by a store to IF through hl is taken right after
+ * the store, on every engine, not at the end of the block it is in
+ */
+static const uint8_t prog[] = {
+	0xfb,			/* ei */
+	0x00,			/* nop */
+	0x21, 0x0f, 0xff,	/* ld hl, IF */
+	0x36, 0x04,		/* ld [hl], INTERRUPT_TIMER */
+	0x04, 0x04, 0x04, 0x04,	/* inc b, 4 times */
+	0x18, 0xfe,		/* jr -2 */
+};
+
+static const uint8_t handler[] = {
+	0x48,			/* ld c, b */
+	0x18, 0xfe,		/* jr -2 */
+};
+
+enum {
+	START = 0xc000,
+	VECTOR = 0x50,
+	MAX = 1000, /* mcycles */
+};
+
+static int
+run(int engine)
+{
+	struct GB *gb = gb_init();
+	struct CPU *cpu = gb->cpu;
+
+	gb->mem[IE] = INTERRUPT_TIMER;
+	memcpy(&gb->mem[START], prog, sizeof(prog));
+	memcpy(&gb->mem[VECTOR], handler, sizeof(handler));
+	cpu->engine = engine;
+	cpu->pc = START;
+	cpu->ime = 0;
+	cpu->b = 0;
+	cpu->c = 0xff; /* b when the handler runs */
+
+	for (long n = 0; cpu->pc != VECTOR + 1 && n < MAX;)
+		n += gb_step(cpu);
+
+	if (cpu->c != 0) {
+		printf("%s: interrupt taken after %d inc b\n", cpu_engines[engine], cpu->c);
+		return 0;
+	}
+
+	return 1;
+}
+
+int
+main(void)
+{
+	int n = 0, passed = 0;
+
+	for (int engine = 0; engine < ENGINES; engine++) {
+		if (cpu_engine(cpu_engines[engine]) < 0)
+			continue;
+		passed += run(engine);
+		n++;
+	}
+	printf("passed %d/%d\n", passed, n);
+
+	return passed != n;
+}
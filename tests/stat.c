@@ -0,0 +1,56 @@
+#include "../src/cpu.h"
+#include "../src/gb.h"
+#include "../src/ppu.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * LYC set to the current line in the middle of a line, when the ppu is
+ * skipped until the next mode change, has to show on the next instruction
+ */
+static const uint8_t prog[] = {
+	0x3e, 0x40,	/* ld a, 0x40 */
+	0xe0, 0x41,	/* ldh [STAT], a, the LY=LYC interrupt */
+	0xf0, 0x44,	/* ldh a, [LY] */
+	0xe0, 0x45,	/* ldh [LYC], a */
+	0xf0, 0x0f,	/* ldh a, [IF] */
+	0x47,		/* ld b, a */
+	0xf0, 0x41,	/* ldh a, [STAT] */
+	0x18, 0xfe,	/* jr -2 */
+};
+
+enum {
+	START = 0xc000,
+	NOPS = 40, /* into mode 3 of line 0, the next mode change is far off */
+};
+
+int
+main(void)
+{
+	struct GB *gb = gb_init();
+	struct CPU *cpu = gb->cpu;
+
+	gb->mem[LYC] = 0x90;
+	gb->mem[IE] = 0;
+	memset(&gb->mem[START], 0x00, NOPS);
+	memcpy(&gb->mem[START + NOPS], prog, sizeof(prog));
+	cpu->pc = START;
+	cpu->ime = 0;
+
+	while (cpu->pc != START + NOPS + sizeof(prog) - 2)
+		execute(cpu);
+
+	int failed = 0;
+	if (!(cpu->b & INTERRUPT_STAT)) {
+		printf("IF 0x%02x, no stat interrupt after LYC=LY\n", cpu->b);
+		failed = 1;
+	}
+	if (!(cpu->a & 0x04)) {
+		printf("STAT 0x%02x, no LY=LYC after LYC=LY\n", cpu->a);
+		failed = 1;
+	}
+	printf("%s\n", failed ? "Failed" : "Passed");
+
+	return failed;
+}
@@ -0,0 +1,120 @@
+/* writes src/alutab.c, run through `make alutab` */
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../src/alu.h"
+
+static void
+table8(const char *name, const char *doc, const uint8_t *t, int n)
+{
+	printf("\n/* %s */\nconst uint8_t %s[%d] = {", doc, name, n);
+	for (int i = 0; i < n; i++)
+		printf("%s0x%02x,", i % 16 ? " " : "\n\t", t[i]);
+	printf("\n};\n");
+}
+
+static void
+table16(const uint16_t *t, int n, const char *indent)
+{
+	for (int i = 0; i < n; i++)
+		printf("%s0x%04x,", i % 8 ? " " : indent, t[i]);
+}
+
+static uint8_t
+zero(uint8_t res)
+{
+	return res == 0 ? FLAG_Z : 0;
+}
+
+static uint16_t
+shift(int op, uint8_t c, uint8_t x)
+{
+	uint8_t res = 0, out = 0;
+
+	switch (op) {
+		case SHIFT_RLC: res = x << 1 | x >> 7; out = x >> 7; break;
+		case SHIFT_RRC: res = x >> 1 | x << 7; out = x & 1; break;
+		case SHIFT_RL: res = x << 1 | c; out = x >> 7; break;
+		case SHIFT_RR: res = x >> 1 | c << 7; out = x & 1; break;
+		case SHIFT_SLA: res = x << 1; out = x >> 7; break;
+		case SHIFT_SRA: res = x >> 1 | (x & 0x80); out = x & 1; break;
+		case SHIFT_SWAP: res = x << 4 | x >> 4; break;
+		case SHIFT_SRL: res = x >> 1; out = x & 1; break;
+	}
+
+	return (zero(res) | (out ? FLAG_C : 0)) << 8 | res;
+}
+
+static uint16_t
+daa(uint8_t nhc, uint8_t a)
+{
+	uint8_t n = nhc >> 2 & 1, h = nhc >> 1 & 1, c = nhc & 1;
+	uint8_t adj = 0;
+
+	if (h || (!n && (a & 0x0f) > 0x09))
+		adj |= 0x06;
+	if (c || (!n && a > 0x99)) {
+		adj |= 0x60;
+		c = 1;
+	}
+
+	a += n ? -adj : adj;
+
+	return (zero(a) | (n ? FLAG_N : 0) | (c ? FLAG_C : 0)) << 8 | a;
+}
+
+int
+main(void)
+{
+	static uint8_t t8[512];
+	static uint16_t t16[8 << 8];
+
+	printf("/* generated by tools/alugen.c, do not edit */\n#include <stdint.h>\n\n#include \"alu.h\"\n");
+
+	for (int i = 0; i < 512; i++)
+		t8[i] = zero(i & 0xff) | (i & 0x100 ? FLAG_C : 0);
+	table8("alu_add", "z and c of a 9 bit sum", t8, 512);
+
+	for (int i = 0; i < 512; i++)
+		t8[i] = zero(i & 0xff) | FLAG_N | (i & 0x100 ? FLAG_C : 0);
+	table8("alu_sub", "z, n and c of a 9 bit difference", t8, 512);
+
+	for (int i = 0; i < 512; i++)
+		t8[i] = (i & 0xf) + (i >> 4 & 0xf) + (i >> 8) > 0xf ? FLAG_H : 0;
+	table8("alu_hadd", "h of carry << 8 | x << 4 | y, low nibbles", t8, 512);
+
+	for (int i = 0; i < 512; i++)
+		t8[i] = (i >> 4 & 0xf) < (i & 0xf) + (i >> 8) ? FLAG_H : 0;
+	table8("alu_hsub", "h of borrow << 8 | x << 4 | y, low nibbles", t8, 512);
+
+	for (int i = 0; i < 256; i++)
+		t8[i] = zero(i) | ((i & 0xf) == 0 ? FLAG_H : 0);
+	table8("alu_inc", "z and h of an incremented result", t8, 256);
+
+	for (int i = 0; i < 256; i++)
+		t8[i] = zero(i) | FLAG_N | ((i & 0xf) == 0xf ? FLAG_H : 0);
+	table8("alu_dec", "z, n and h of a decremented result", t8, 256);
+
+	for (int i = 0; i < 8 << 8; i++)
+		t16[i] = daa(i >> 8, i & 0xff);
+	printf("\n/* n << 10 | h << 9 | c << 8 | a -> f << 8 | a */\nconst uint16_t alu_daa[8 << 8] = {");
+	table16(t16, 8 << 8, "\n\t");
+	printf("\n};\n");
+
+	static const char *names[8] = { "rlc", "rrc", "rl", "rr", "sla", "sra", "swap", "srl" };
+	printf("\n/* op, carry in, x -> f << 8 | res */\nconst uint16_t alu_shift[8][2][256] = {");
+	for (int op = 0; op < 8; op++) {
+		printf("\n\t{ /* %s */", names[op]);
+		for (int c = 0; c < 2; c++) {
+			for (int x = 0; x < 256; x++)
+				t16[x] = shift(op, c, x);
+			printf("\n\t\t{");
+			table16(t16, 256, "\n\t\t\t");
+			printf("\n\t\t},");
+		}
+		printf("\n\t},");
+	}
+	printf("\n};\n");
+
+	return 0;
+}
@@ -0,0 +1,40 @@
+/* prints a trace file from gbem -t oldest first, as a Gameboy Doctor log */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/trace.h"
+
+int
+main(int argc, char **argv)
+{
+	const char *path = argc > 1 ? argv[1] : "trace.bin";
+	FILE *f = fopen(path, "rb");
+	struct TraceHeader hdr;
+
+	if (f == NULL || fread(&hdr, sizeof(hdr), 1, f) != 1) {
+		fprintf(stderr, "unable to read %s\n", path);
+		return 1;
+	}
+	if (memcmp(hdr.magic, TRACE_MAGIC, sizeof(hdr.magic)) != 0
+	    || hdr.size != sizeof(struct TraceRecord) || hdr.len == 0
+	    || (hdr.len & (hdr.len - 1)) != 0) {
+		fprintf(stderr, "%s is not a trace\n", path);
+		return 1;
+	}
+
+	struct TraceRecord *rec = malloc((size_t)hdr.len * hdr.size);
+	if (rec == NULL || fread(rec, hdr.size, hdr.len, f) != hdr.len) {
+		fprintf(stderr, "%s is cut short\n", path);
+		return 1;
+	}
+
+	uint64_t first = hdr.n > hdr.len ? hdr.n - hdr.len : 0;
+	for (uint64_t i = first; i < hdr.n; i++)
+		trace_print(&rec[i & (hdr.len - 1)], stdout);
+
+	free(rec);
+	fclose(f);
+	return 0;
+}